@@ -0,0 +1,216 @@
+#ifndef SRC_21_NODE_POOL_H
+#define SRC_21_NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Пул узлов дерева. Память выделяется блоками (каждый следующий вдвое
+// больше, до kMaxBlockSize узлов), новые узлы нарезаются из текущего блока
+// подряд, а освобожденные попадают в список свободных и переиспользуются
+// первыми. Reset возвращает всю память пула в работу за O(числа блоков), не
+// освобождая ее: вызывающий должен сам разрушить живые узлы, если их
+// деструктор нетривиален. Память отдается системе только в деструкторе.
+template <typename Node>
+class NodePool {
+ public:
+  using size_type = size_t;
+
+  NodePool() = default;
+
+  NodePool(const NodePool &other) = delete;
+  NodePool &operator=(const NodePool &other) = delete;
+
+  NodePool(NodePool &&other) noexcept { swap(other); }
+
+  NodePool &operator=(NodePool &&other) noexcept {
+    if (this != &other) {
+      NodePool empty;
+      swap(empty);
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~NodePool() {
+    while (first_ != nullptr) {
+      Block *next = first_->next;
+      delete[] first_->slots;
+      delete first_;
+      first_ = next;
+    }
+  }
+
+  template <typename... Args>
+  Node *Create(Args &&...args) {
+    Slot *slot = Take();
+    try {
+      return new (slot->storage) Node(std::forward<Args>(args)...);
+    } catch (...) {
+      Give(slot);
+      throw;
+    }
+  }
+
+  void Destroy(Node *node) noexcept {
+    if (node == nullptr) return;
+    node->~Node();
+    Give(reinterpret_cast<Slot *>(node));
+  }
+
+  // гарантирует, что еще count узлов будут созданы без выделения памяти
+  void Reserve(size_type count) {
+    size_type available = capacity_ - live_;
+    if (count > available) {
+      AddBlock(count - available);
+    }
+  }
+
+  // все узлы пула считаются свободными
+  void Reset() noexcept {
+    free_ = nullptr;
+    current_ = first_;
+    bump_ = first_ != nullptr ? first_->slots : nullptr;
+    live_ = 0;
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // забирает всю память other вместе с живыми узлами: узлы other остаются
+  // на своих местах, но освобождать их теперь нужно через этот пул. Каждый
+  // свободный слот other остается достижимым, поэтому capacity_ честно
+  // складывается и Reserve не завышает запас
+  void Splice(NodePool &other) noexcept {
+    if (this == &other || other.first_ == nullptr) return;
+    if (first_ == nullptr) {
+      swap(other);
+      return;
+    }
+    if (other.free_ != nullptr) {
+      Slot *tail = other.free_;
+      while (tail->next != nullptr) tail = tail->next;
+      tail->next = free_;
+      free_ = other.free_;
+    }
+    // недорезанный остаток текущего блока other уходит в список свободных
+    Block *used = other.current_;
+    for (Slot *slot = other.bump_; slot != used->slots + used->size; ++slot) {
+      slot->next = free_;
+      free_ = slot;
+    }
+    // нарезанные блоки other встают в начало списка, а нетронутые -- сразу
+    // за нашим текущим блоком, чтобы нарезка дошла до них
+    Block *untouched = used->next;
+    used->next = first_;
+    first_ = other.first_;
+    if (untouched != nullptr) {
+      other.last_->next = current_->next;
+      current_->next = untouched;
+      if (last_ == current_) last_ = other.last_;
+    }
+    capacity_ += other.capacity_;
+    live_ += other.live_;
+    if (next_block_size_ < other.next_block_size_) {
+      next_block_size_ = other.next_block_size_;
+    }
+    other.free_ = nullptr;
+    other.first_ = other.last_ = other.current_ = nullptr;
+    other.bump_ = nullptr;
+    other.capacity_ = other.live_ = 0;
+    other.next_block_size_ = kFirstBlockSize;
+  }
+
+  void swap(NodePool &other) noexcept {
+    std::swap(free_, other.free_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(current_, other.current_);
+    std::swap(bump_, other.bump_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(live_, other.live_);
+    std::swap(next_block_size_, other.next_block_size_);
+  }
+
+ private:
+  static constexpr size_type kFirstBlockSize = 16;
+  static constexpr size_type kMaxBlockSize = 4096;
+
+  union Slot {
+    Slot *next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  struct Block {
+    Block *next;
+    Slot *slots;
+    size_type size;
+  };
+
+  Slot *free_ = nullptr;
+  // блоки в порядке выделения; current_ -- блок, из которого идет нарезка
+  Block *first_ = nullptr;
+  Block *last_ = nullptr;
+  Block *current_ = nullptr;
+  Slot *bump_ = nullptr;
+  size_type capacity_ = 0;
+  size_type live_ = 0;
+  size_type next_block_size_ = kFirstBlockSize;
+
+  Slot *Take() {
+    Slot *slot = free_;
+    if (slot != nullptr) {
+      free_ = slot->next;
+    } else {
+      while (current_ != nullptr &&
+             bump_ == current_->slots + current_->size) {
+        current_ = current_->next;
+        bump_ = current_ != nullptr ? current_->slots : nullptr;
+      }
+      if (current_ == nullptr) {
+        AddBlock(next_block_size_);
+      }
+      slot = bump_++;
+    }
+    ++live_;
+    return slot;
+  }
+
+  void Give(Slot *slot) noexcept {
+    slot->next = free_;
+    free_ = slot;
+    --live_;
+  }
+
+  void AddBlock(size_type size) {
+    if (size < next_block_size_) {
+      size = next_block_size_;
+    }
+    Block *block = new Block{nullptr, nullptr, size};
+    try {
+      block->slots = new Slot[size];
+    } catch (...) {
+      delete block;
+      throw;
+    }
+    if (last_ != nullptr) {
+      last_->next = block;
+    } else {
+      first_ = block;
+    }
+    last_ = block;
+    if (current_ == nullptr) {
+      current_ = block;
+      bump_ = block->slots;
+    }
+    capacity_ += size;
+    if (next_block_size_ < kMaxBlockSize) {
+      next_block_size_ *= 2;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_21_NODE_POOL_H
@@ -1,14 +1,28 @@
 #ifndef SRC_21_TREE_H
 #define SRC_21_TREE_H
 
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 #include "../s21_vector.h"
+#include "s21_node_pool.h"
 
 namespace s21 {
 
+// компаратор с is_transparent (например, std::less<>) сравнивает ключ с
+// любым совместимым типом, и поиск не строит ключ из аргумента
+template <typename Compare, typename = void>
+struct IsTransparent : std::false_type {};
+
+template <typename Compare>
+struct IsTransparent<Compare, std::void_t<typename Compare::is_transparent>>
+    : std::true_type {};
+
 template <typename Key, typename Comparator = std::less<Key>>
 class RBTree {
  public:
@@ -46,6 +60,15 @@ class RBTree {
           right_(nullptr),
           key_(key){};
 
+    // значение строится прямо в узле
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args &&...args)
+        : colour_(Red),
+          parent_(nullptr),
+          left_(nullptr),
+          right_(nullptr),
+          key_(std::forward<Args>(args)...) {}
+
     Node *grandparent() {
       if (parent_ != nullptr) {
         return parent_->parent_;
@@ -175,15 +198,17 @@ class RBTree {
   };
 
  public:
-  RBTree() : head_(new Node()), size_{} {}
+  RBTree() : head_(pool_.Create()), size_{} {}
 
   RBTree(const RBTree<value_type, Comparator> &other) : RBTree() {
     Clear();
     if (!other.empty()) {
+      pool_.Reserve(other.size_);
       head_ = CopyTree(other.head_, nullptr);
       size_ = other.size_;
+      UpdateRightmost();
     } else {
-      head_ = new Node;
+      head_ = pool_.Create();
     }
   }
 
@@ -194,9 +219,14 @@ class RBTree {
     }
   }
 
+  // уже упорядоченный список собирается за O(n) без поворотов
   RBTree(std::initializer_list<value_type> const &items) : RBTree() {
-    for (const auto &item : items) {
-      InsertUnique(item);
+    if (IsSorted(items.begin(), items.end())) {
+      AssignSorted(items.begin(), items.end(), true);
+    } else {
+      for (const auto &item : items) {
+        InsertUnique(item);
+      }
     }
   }
 
@@ -204,8 +234,10 @@ class RBTree {
     if (this != &other && !other.empty()) {
       Clear();
       if (!other.empty()) {
+        pool_.Reserve(other.size_);
         head_ = CopyTree(other.head_, nullptr);
         size_ = other.size_;
+        UpdateRightmost();
       }
     }
     return *this;
@@ -216,8 +248,11 @@ class RBTree {
       Clear();
       head_ = other.head_;
       size_ = other.size_;
+      rightmost_ = other.rightmost_;
+      pool_.swap(other.pool_);
       other.head_ = nullptr;
       other.size_ = 0;
+      other.rightmost_ = nullptr;
     }
     return *this;
   }
@@ -245,6 +280,44 @@ class RBTree {
       return Iterator(node_to_find, this);
   }
 
+  template <typename K, typename C = Comparator,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator find(const K &key) {
+    Node *node_to_find = FindNode(head_, key);
+    if (node_to_find == nullptr)
+      return end();
+    else
+      return Iterator(node_to_find, this);
+  }
+
+  // первый элемент, не меньший key
+  iterator lower_bound(const Key &key) { return LowerBound(key); }
+
+  template <typename K, typename C = Comparator,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator lower_bound(const K &key) {
+    return LowerBound(key);
+  }
+
+  // первый элемент, больший key
+  iterator upper_bound(const Key &key) { return UpperBound(key); }
+
+  template <typename K, typename C = Comparator,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator upper_bound(const K &key) {
+    return UpperBound(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    return std::pair<iterator, iterator>(LowerBound(key), UpperBound(key));
+  }
+
+  template <typename K, typename C = Comparator,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return std::pair<iterator, iterator>(LowerBound(key), UpperBound(key));
+  }
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
     s21::vector<std::pair<iterator, bool>> results;
@@ -256,6 +329,8 @@ class RBTree {
   void swap(RBTree &other) {
     std::swap(this->head_, other.head_);
     std::swap(this->size_, other.size_);
+    std::swap(this->rightmost_, other.rightmost_);
+    this->pool_.swap(other.pool_);
     std::swap(this->compare_, other.compare_);
   }
 
@@ -263,31 +338,41 @@ class RBTree {
     if (pos.current_ != nullptr) {
       RemoveNode(pos.current_);
       --size_;
+      UpdateRightmost();
     }
   }
 
   void clear() noexcept {
     Clear();
-    head_ = new Node();
+    head_ = pool_.Create();
   }
 
-  void merge(RBTree &other) {
-    if (!other.empty()) {
-      iterator start = other.begin();
-      iterator end = other.end();
-      for (; start != end; ++start) {
-        InsertUnique(*start);
-      }
-      other.Clear();
+  // гарантирует, что дерево дорастет до count элементов без выделения
+  // памяти
+  void reserve(size_type count) {
+    if (count > size_) {
+      pool_.Reserve(count - size_);
     }
   }
 
+  // узлы other перевешиваются в это дерево без копирования ключей;
+  // элементы, чьи ключи здесь уже есть, остаются в other. Указатели и
+  // ссылки на перенесенные элементы остаются верными, а итераторы other --
+  // нет: они по-прежнему ссылаются на other. Оставшиеся в other элементы
+  // собираются в новых узлах, и все ссылки на них тоже становятся неверными
+  void merge(RBTree &other) { Merge(other, true); }
+
  protected:
+  // объявлен раньше head_: конструктор берет из пула узел-заглушку
+  NodePool<Node> pool_;
   Node *head_;
   size_type size_{};
   Comparator compare_;
+  // узел с наибольшим ключом: вставка в конец по подсказке идет без спуска
+  Node *rightmost_ = nullptr;
 
-  bool Contains(const Key &key) const noexcept {
+  template <typename K>
+  bool Contains(const K &key) const noexcept {
     Node *node_to_find = FindNode(head_, key);
     return node_to_find != nullptr;
   }
@@ -306,65 +391,451 @@ class RBTree {
     return current;
   }
 
-  void MergeMultiset(RBTree &other) {
-    if (!other.empty()) {
-      iterator start = other.begin();
-      iterator end = other.end();
-      for (; start != end; ++start) {
-        InsertNotUnique(*start);
+  void MergeMultiset(RBTree &other) { Merge(other, false); }
+
+  enum SetOperation { Union, Intersection, Difference, SymmetricDifference };
+
+  // заменяет содержимое результатом операции над множествами a и b: оба
+  // дерева обходятся по порядку одновременно, результат собирается
+  // AssignSorted, всего O(n + m)
+  void AssignSetOperation(const RBTree &a, const RBTree &b,
+                          SetOperation operation) {
+    bool keep_a = operation != Intersection;
+    bool keep_b = operation == Union || operation == SymmetricDifference;
+    bool keep_both = operation == Union || operation == Intersection;
+    s21::vector<value_type> keys;
+    keys.reserve(a.size_ + (keep_b ? b.size_ : 0));
+    Node *x = a.empty() ? nullptr : MinNode(a.head_);
+    Node *y = b.empty() ? nullptr : MinNode(b.head_);
+    while (x != nullptr && y != nullptr) {
+      if (compare_(x->key_, y->key_)) {
+        if (keep_a) keys.push_back(x->key_);
+        x = NextNode(x);
+      } else if (compare_(y->key_, x->key_)) {
+        if (keep_b) keys.push_back(y->key_);
+        y = NextNode(y);
+      } else {
+        if (keep_both) keys.push_back(x->key_);
+        x = NextNode(x);
+        y = NextNode(y);
+      }
+    }
+    for (; keep_a && x != nullptr; x = NextNode(x)) keys.push_back(x->key_);
+    for (; keep_b && y != nullptr; y = NextNode(y)) keys.push_back(y->key_);
+    AssignSorted(std::make_move_iterator(keys.begin()),
+                 std::make_move_iterator(keys.end()), true);
+  }
+
+  // память other переходит в пул этого дерева, узлы перевешиваются. Если
+  // other мал, каждый узел вставляется отдельным спуском за
+  // O(m log(n + m)), иначе обе последовательности узлов сливаются и дерево
+  // заново связывается по медианам за O(n + m). Ключи отвергнутых при
+  // is_unique узлов переносятся в новые узлы other, сами узлы уничтожаются
+  void Merge(RBTree &other, bool is_unique) {
+    if (this == &other || other.empty()) return;
+    size_type total = size_ + other.size_;
+    size_type depth = 1;
+    while ((size_type{1} << depth) <= total) ++depth;
+    s21::vector<Node *> incoming = other.InOrderNodes();
+    s21::vector<Node *> rejected;
+    rejected.reserve(incoming.size());
+    if (other.size_ * depth < total) {
+      pool_.Splice(other.pool_);
+      for (size_type i = 0; i < incoming.size(); ++i) {
+        Node *node = incoming[i];
+        node->parent_ = node->left_ = node->right_ = nullptr;
+        node->colour_ = Red;
+        Node *parent;
+        bool is_left;
+        if (FindSlot(node->key_, is_unique, parent, is_left) != nullptr) {
+          rejected.push_back(node);
+        } else {
+          LinkNode(node, parent, is_left);
+        }
+      }
+    } else {
+      s21::vector<Node *> own = InOrderNodes();
+      s21::vector<Node *> merged;
+      merged.reserve(total);
+      pool_.Splice(other.pool_);
+      size_type i = 0, j = 0;
+      while (i < own.size() || j < incoming.size()) {
+        if (j == incoming.size() ||
+            (i < own.size() && !compare_(incoming[j]->key_, own[i]->key_))) {
+          if (is_unique && j < incoming.size() &&
+              !compare_(own[i]->key_, incoming[j]->key_)) {
+            rejected.push_back(incoming[j++]);
+          }
+          merged.push_back(own[i++]);
+        } else {
+          merged.push_back(incoming[j++]);
+        }
       }
-      other.Clear();
+      if (empty()) pool_.Destroy(head_);
+      size_type red_depth = 0;
+      while ((size_type{2} << red_depth) <= merged.size()) ++red_depth;
+      head_ = RelinkSorted(merged.data(), merged.size(), 0, red_depth);
+      head_->parent_ = nullptr;
+      head_->colour_ = Black;
+      size_ = merged.size();
+      UpdateRightmost();
+    }
+    other.head_ = nullptr;
+    other.size_ = 0;
+    other.rightmost_ = nullptr;
+    s21::vector<value_type> left;
+    for (size_type k = 0; k < rejected.size(); ++k) {
+      left.push_back(std::move(rejected[k]->key_));
+      pool_.Destroy(rejected[k]);
+    }
+    other.AssignSorted(std::make_move_iterator(left.begin()),
+                       std::make_move_iterator(left.end()), false);
+  }
+
+  s21::vector<Node *> InOrderNodes() const {
+    s21::vector<Node *> nodes;
+    nodes.reserve(size_);
+    for (Node *node = empty() ? nullptr : MinNode(head_); node != nullptr;
+         node = NextNode(node)) {
+      nodes.push_back(node);
     }
+    return nodes;
+  }
+
+  // как BuildSorted, но из готовых узлов
+  static Node *RelinkSorted(Node **nodes, size_type count, size_type depth,
+                            size_type red_depth) noexcept {
+    if (count == 0) return nullptr;
+    size_type left_count = (count - 1) / 2;
+    Node *node = nodes[left_count];
+    node->left_ = RelinkSorted(nodes, left_count, depth + 1, red_depth);
+    node->right_ = RelinkSorted(nodes + left_count + 1, count - 1 - left_count,
+                                depth + 1, red_depth);
+    if (node->left_ != nullptr) node->left_->parent_ = node;
+    if (node->right_ != nullptr) node->right_->parent_ = node;
+    node->colour_ = depth == red_depth ? Red : Black;
+    return node;
   }
 
+  // для тривиально разрушаемых ключей узлы не обходятся: пул просто
+  // забирает всю память обратно
   void Clear() noexcept {
-    if (!this->empty()) {
-      DeleteNodes(head_);
-    } else
-      delete head_;
+    if constexpr (!std::is_trivially_destructible<Node>::value) {
+      if (!this->empty()) {
+        DeleteNodes(head_);
+      } else
+        pool_.Destroy(head_);
+    }
+    pool_.Reset();
     head_ = nullptr;
     size_ = 0;
+    rightmost_ = nullptr;
+  }
+
+  void UpdateRightmost() noexcept {
+    rightmost_ = empty() ? nullptr : MaxNode(head_);
+  }
+
+  // спуск от корня: O(log n), равные ключи не просматриваются
+  template <typename K>
+  iterator LowerBound(const K &key) {
+    Node *node = head_;
+    Node *bound = nullptr;
+    while (!IsNodeNull(node)) {
+      if (compare_(node->key_, key)) {
+        node = node->right_;
+      } else {
+        bound = node;
+        node = node->left_;
+      }
+    }
+    return iterator(bound, this);
+  }
+
+  template <typename K>
+  iterator UpperBound(const K &key) {
+    Node *node = head_;
+    Node *bound = nullptr;
+    while (!IsNodeNull(node)) {
+      if (compare_(key, node->key_)) {
+        bound = node;
+        node = node->left_;
+      } else {
+        node = node->right_;
+      }
+    }
+    return iterator(bound, this);
+  }
+
+  // O(log n + k): от нижней границы вперед, пока ключи равны key
+  template <typename K>
+  size_type CountEqual(const K &key) {
+    size_type count = 0;
+    for (Node *node = LowerBound(key).current_;
+         node != nullptr && !compare_(key, node->key_); node = NextNode(node)) {
+      ++count;
+    }
+    return count;
+  }
+
+  // предыдущий по порядку узел; nullptr перед минимальным
+  static Node *PrevNode(Node *node) noexcept {
+    if (node->left_ != nullptr) return MaxNode(node->left_);
+    Node *parent = node->parent_;
+    while (parent != nullptr && node == parent->left_) {
+      node = parent;
+      parent = parent->parent_;
+    }
+    return parent;
+  }
+
+  // следующий по порядку узел; nullptr после максимального (в отличие от
+  // Iterator::Successor, который переходит на начало)
+  static Node *NextNode(Node *node) noexcept {
+    if (node->right_ != nullptr) return MinNode(node->right_);
+    Node *parent = node->parent_;
+    while (parent != nullptr && node == parent->right_) {
+      node = parent;
+      parent = parent->parent_;
+    }
+    return parent;
   }
 
   bool IsNodeNull(Node *current) const {
     return current == nullptr || this->size_ == 0;
   }
 
-  std::pair<iterator, bool> InsertUnique(const value_type &value) noexcept {
-    Node *insert_node = new Node(value);
+  // узел выделяется, только если ключа еще нет
+  std::pair<iterator, bool> InsertUnique(const value_type &value) {
+    return TryEmplace(value, value);
+  }
+
+  // key сравнивается с ключами дерева до того, как из args строится
+  // значение
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(const K &key, Args &&...args) {
+    Node *parent;
+    bool is_left;
+    Node *found = FindSlot(key, true, parent, is_left);
+    if (found != nullptr) {
+      return std::pair<iterator, bool>(iterator(found, this), false);
+    }
+    Node *insert_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
+    return std::pair<iterator, bool>(LinkNode(insert_node, parent, is_left),
+                                     true);
+  }
+
+  // как TryEmplace, но сначала проверяет соседство hint
+  template <typename K, typename... Args>
+  iterator TryEmplaceHint(iterator hint, const K &key, Args &&...args) {
+    Node *parent;
+    bool is_left;
+    Node *found;
+    if (!FindSlotNear(hint.current_, key, true, parent, is_left, found)) {
+      return TryEmplace(key, std::forward<Args>(args)...).first;
+    }
+    if (found != nullptr) {
+      return iterator(found, this);
+    }
+    Node *insert_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
+    return LinkNode(insert_node, parent, is_left);
+  }
+
+  template <typename... Args>
+  iterator EmplaceHint(iterator hint, bool is_unique, Args &&...args) {
+    Node *insert_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
+    Node *parent;
+    bool is_left;
+    Node *found;
+    if (!FindSlotNear(hint.current_, insert_node->key_, is_unique, parent,
+                      is_left, found)) {
+      std::pair<iterator, bool> result = Insert(insert_node, is_unique);
+      if (result.second == false) {
+        pool_.Destroy(insert_node);
+      }
+      return result.first;
+    }
+    if (found != nullptr) {
+      pool_.Destroy(insert_node);
+      return iterator(found, this);
+    }
+    return LinkNode(insert_node, parent, is_left);
+  }
+
+  // место для key рядом с подсказкой hint (nullptr -- end()): новый узел
+  // встает прямо перед hint или прямо после него. Возвращает false, если
+  // key туда не попадает и нужен обычный спуск; иначе заполняет parent и
+  // is_left, а при совпадении ключа (is_unique) -- found. Для вставки в
+  // конец по end() или по последнему элементу сравнений O(1)
+  template <typename K>
+  bool FindSlotNear(Node *hint, const K &key, bool is_unique, Node *&parent,
+                    bool &is_left, Node *&found) const {
+    found = nullptr;
+    if (empty()) return false;
+    if (hint != nullptr && compare_(hint->key_, key)) {
+      Node *after = hint == rightmost_ ? nullptr : NextNode(hint);
+      if (after != nullptr) {
+        if (compare_(after->key_, key)) return false;
+        if (is_unique && !compare_(key, after->key_)) {
+          found = after;
+          return true;
+        }
+      }
+      if (hint->right_ == nullptr) {
+        parent = hint;
+        is_left = false;
+      } else {
+        // after -- минимум правого поддерева hint, левого сына у него нет
+        parent = after;
+        is_left = true;
+      }
+      return true;
+    }
+    if (hint != nullptr && is_unique && !compare_(key, hint->key_)) {
+      found = hint;
+      return true;
+    }
+    Node *before = hint == nullptr ? rightmost_ : PrevNode(hint);
+    if (before != nullptr) {
+      if (compare_(key, before->key_)) return false;
+      if (is_unique && !compare_(before->key_, key)) {
+        found = before;
+        return true;
+      }
+    }
+    if (hint != nullptr && hint->left_ == nullptr) {
+      parent = hint;
+      is_left = true;
+    } else {
+      // before -- максимум левого поддерева hint (или всего дерева),
+      // правого сына у него нет
+      parent = before;
+      is_left = false;
+    }
+    return true;
+  }
+
+  // ключ известен только после построения значения, поэтому узел берется
+  // из пула заранее и при совпадении сразу возвращается в него
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceUnique(Args &&...args) {
+    Node *insert_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
     std::pair<iterator, bool> result = Insert(insert_node, true);
     if (result.second == false) {
-      delete insert_node;
+      pool_.Destroy(insert_node);
     }
     return result;
   }
 
-  iterator InsertNotUnique(const value_type &value) noexcept {
-    Node *insert_node = new Node(value);
+  template <typename... Args>
+  iterator EmplaceNotUnique(Args &&...args) {
+    Node *insert_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
+    return Insert(insert_node, false).first;
+  }
+
+  iterator InsertNotUnique(const value_type &value) {
+    Node *insert_node = pool_.Create(value);
     iterator result = Insert(insert_node, false).first;
     return result;
   }
 
-  std::pair<iterator, bool> InsertManyNotUnique(
-      const value_type &value) noexcept {
-    Node *insert_node = new Node(value);
+  std::pair<iterator, bool> InsertManyNotUnique(const value_type &value) {
+    Node *insert_node = pool_.Create(value);
     std::pair<iterator, bool> result = Insert(insert_node, false);
     return result;
   }
 
+  // неубывает ли диапазон по compare_
+  template <typename ForwardIt>
+  bool IsSorted(ForwardIt first, ForwardIt last) const {
+    if (first == last) return true;
+    for (ForwardIt next = std::next(first); next != last; ++first, ++next) {
+      if (compare_(*next, *first)) return false;
+    }
+    return true;
+  }
+
+  // заменяет содержимое деревом из неубывающего диапазона за O(n): узлы
+  // раскладываются по медианам, так что заполнены все уровни, кроме
+  // последнего, и красными становятся только узлы последнего уровня. При
+  // is_unique из каждой группы равных ключей берется первый
+  template <typename ForwardIt>
+  void AssignSorted(ForwardIt first, ForwardIt last, bool is_unique) {
+    size_type count = 0;
+    for (ForwardIt it = first, prev = first; it != last; prev = it, ++it) {
+      if (!is_unique || it == first || compare_(*prev, *it)) ++count;
+    }
+    clear();
+    if (count == 0) return;
+    reserve(count);
+    size_type red_depth = 0;
+    while ((size_type{2} << red_depth) <= count) ++red_depth;
+    // DeleteNodes при откате считает дерево непустым
+    size_ = count;
+    Node *root;
+    try {
+      root = BuildSorted(first, last, is_unique, count, 0, red_depth);
+    } catch (...) {
+      size_ = 0;
+      throw;
+    }
+    pool_.Destroy(head_);
+    head_ = root;
+    root->colour_ = Black;
+    UpdateRightmost();
+  }
+
+  template <typename ForwardIt>
+  Node *BuildSorted(ForwardIt &first, ForwardIt last, bool is_unique,
+                    size_type count, size_type depth, size_type red_depth) {
+    if (count == 0) return nullptr;
+    size_type left_count = (count - 1) / 2;
+    Node *left = BuildSorted(first, last, is_unique, left_count, depth + 1,
+                             red_depth);
+    Node *node;
+    try {
+      node = pool_.Create(*first);
+    } catch (...) {
+      DeleteNodes(left);
+      throw;
+    }
+    ++first;
+    while (is_unique && first != last && !compare_(node->key_, *first)) {
+      ++first;
+    }
+    Node *right;
+    try {
+      right = BuildSorted(first, last, is_unique, count - 1 - left_count,
+                          depth + 1, red_depth);
+    } catch (...) {
+      DeleteNodes(left);
+      pool_.Destroy(node);
+      throw;
+    }
+    node->colour_ = depth == red_depth ? Red : Black;
+    node->left_ = left;
+    node->right_ = right;
+    if (left != nullptr) left->parent_ = node;
+    if (right != nullptr) right->parent_ = node;
+    return node;
+  }
+
   void DeleteNodes(Node *current) {
     if (IsNodeNull(current) != true) {
       DeleteNodes(current->left_);
       DeleteNodes(current->right_);
-      delete current;
-      current = nullptr;
+      pool_.Destroy(current);
     }
   }
 
   Node *CopyTree(Node *other_node, Node *parent) {
     if (other_node == nullptr) return nullptr;
-    Node *new_node = new Node();
-    new_node->key_ = other_node->key_;
+    Node *new_node = pool_.Create(other_node->key_);
     new_node->colour_ = other_node->colour_;
     new_node->parent_ = parent;
     new_node->left_ = CopyTree(other_node->left_, new_node);
@@ -372,17 +843,19 @@ class RBTree {
     return new_node;
   }
 
-  Node *FindNode(Node *node, key_type key) const {
-    if (node != nullptr && !compare_(key, node->key_) &&
-        !compare_(node->key_, key))
-      return node;
-    else if (node == nullptr)
-      return nullptr;
-
-    if (compare_(key, node->key_))
-      return FindNode(node->left_, key);
-    else
-      return FindNode(node->right_, key);
+  // key -- любой тип, который компаратор умеет сравнивать с value_type
+  template <typename K>
+  Node *FindNode(Node *node, const K &key) const {
+    while (!IsNodeNull(node)) {
+      if (compare_(key, node->key_)) {
+        node = node->left_;
+      } else if (compare_(node->key_, key)) {
+        node = node->right_;
+      } else {
+        return node;
+      }
+    }
+    return nullptr;
   }
 
   void InsertFixup(Node *current_node) {
@@ -504,7 +977,8 @@ class RBTree {
         bool isBlack = node_to_fix->parent_->colour_ == Black;
         brother->colour_ = Red;
         node_to_fix->parent_->colour_ = Black;
-        if (isBlack) RemoveFixupLeft(node_to_fix);
+        // родитель был черным -- недостача черной высоты поднимается к нему
+        if (isBlack) RemoveFixup(node_to_fix->parent_);
       }
     }  // 2) брат красный
     else if (brother != nullptr && brother->colour_ == Red) {
@@ -539,7 +1013,7 @@ class RBTree {
         bool isBlack = node_to_fix->parent_->colour_ == Black;
         brother->colour_ = Red;
         node_to_fix->parent_->colour_ = Black;
-        if (isBlack) RemoveFixupRight(node_to_fix);
+        if (isBlack) RemoveFixup(node_to_fix->parent_);
       }
 
     } else {
@@ -553,6 +1027,14 @@ class RBTree {
     }
   }
 
+  void RemoveFixup(Node *node_to_fix) {
+    if (node_to_fix->parent_ == nullptr) return;
+    if (node_to_fix == node_to_fix->parent_->left_)
+      RemoveFixupLeft(node_to_fix);
+    else
+      RemoveFixupRight(node_to_fix);
+  }
+
   void RemoveNode(Node *node_to_delete) {
     if (node_to_delete->colour_ == Red && node_to_delete->left_ == nullptr &&
         node_to_delete->right_ == nullptr) {
@@ -560,7 +1042,7 @@ class RBTree {
         node_to_delete->parent_->left_ = nullptr;
       else
         node_to_delete->parent_->right_ = nullptr;
-      delete node_to_delete;
+      pool_.Destroy(node_to_delete);
     }
 
     else if (node_to_delete->colour_ == Red &&
@@ -601,46 +1083,70 @@ class RBTree {
           node_to_delete->parent_->right_ = nullptr;
       }
       if (head_ == node_to_delete) {
-        delete head_;
-        head_ = nullptr;
-        head_ = new Node();
+        pool_.Destroy(head_);
+        head_ = pool_.Create();
         size_ = 1;
       } else
-        delete node_to_delete;
+        pool_.Destroy(node_to_delete);
     }
   }
 
   std::pair<iterator, bool> Insert(Node *insert_node, bool is_unique) {
+    Node *parent;
+    bool is_left;
+    Node *found = FindSlot(insert_node->key_, is_unique, parent, is_left);
+    if (found != nullptr) {
+      return std::pair<iterator, bool>(iterator(found, this), false);
+    }
+    return std::pair<iterator, bool>(LinkNode(insert_node, parent, is_left),
+                                     true);
+  }
+
+  // спуск от корня: если is_unique и ключ уже есть, возвращает его узел,
+  // иначе nullptr, а в parent и is_left -- место для нового узла (равные
+  // ключи уходят вправо)
+  template <typename K>
+  Node *FindSlot(const K &key, bool is_unique, Node *&parent,
+                 bool &is_left) const {
     Node *current_node = head_;
-    Node *previous_node = nullptr;
+    parent = nullptr;
+    is_left = false;
     while (!IsNodeNull(current_node)) {
-      previous_node = current_node;
-
-      if (compare_(insert_node->key_, current_node->key_)) {
+      parent = current_node;
+      if (compare_(key, current_node->key_)) {
+        is_left = true;
         current_node = current_node->left_;
       } else {
-        if (is_unique && !compare_(current_node->key_, insert_node->key_)) {
-          return std::pair<iterator, bool>(iterator(current_node, this), false);
+        if (is_unique && !compare_(current_node->key_, key)) {
+          return current_node;
         }
+        is_left = false;
         current_node = current_node->right_;
       }
     }
-    delete current_node;
+    return nullptr;
+  }
 
-    if (previous_node == nullptr) {
+  iterator LinkNode(Node *insert_node, Node *parent, bool is_left) noexcept {
+    if (parent == nullptr || (parent == rightmost_ && !is_left)) {
+      rightmost_ = insert_node;
+    }
+    if (parent == nullptr) {
+      // в пустом дереве head_ -- узел-заглушка
+      pool_.Destroy(head_);
       head_ = insert_node;
       insert_node->colour_ = Black;
     } else {
-      insert_node->parent_ = previous_node;
-      if (compare_(insert_node->key_, previous_node->key_)) {
-        previous_node->left_ = insert_node;
+      insert_node->parent_ = parent;
+      if (is_left) {
+        parent->left_ = insert_node;
       } else {
-        previous_node->right_ = insert_node;
+        parent->right_ = insert_node;
       }
     }
     ++size_;
     InsertFixup(insert_node);
-    return std::pair<iterator, bool>(iterator(insert_node, this), true);
+    return iterator(insert_node, this);
   }
 
 };  // class RBTree
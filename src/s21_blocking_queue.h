@@ -0,0 +1,171 @@
+#ifndef S21_BLOCKING_QUEUE_H
+#define S21_BLOCKING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "s21_concurrency/s21_sync.h"
+#include "s21_queue.h"
+
+namespace s21 {
+
+// Потокобезопасная неограниченная очередь на основе s21::queue. Потребитель,
+// заставший очередь пустой, сначала коротко крутится, следя за атомарной
+// копией размера, и только потом засыпает на condition_variable. Пакетные
+// push_batch и drain_into берут мьютекс один раз на весь пакет.
+template <typename T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  blocking_queue() = default;
+
+  blocking_queue(const blocking_queue &other) = delete;
+  blocking_queue &operator=(const blocking_queue &other) = delete;
+
+  ~blocking_queue() = default;
+
+  void push(const_reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_.push(value);
+    Published(lock, 1);
+  }
+
+  void push(value_type &&value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_.push(std::move(value));
+    Published(lock, 1);
+  }
+
+  // если вставка бросит, уже вставленная часть пакета остается в очереди
+  // и объявляется ожидающим потребителям
+  template <typename InputIt>
+  void push_batch(InputIt first, InputIt last) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_type count = 0;
+    try {
+      for (; first != last; ++first, ++count) {
+        queue_.push(*first);
+      }
+    } catch (...) {
+      Published(lock, count);
+      throw;
+    }
+    Published(lock, count);
+  }
+
+  value_type pop() {
+    std::unique_lock<std::mutex> lock = WaitNonEmpty();
+    return Take();
+  }
+
+  bool try_pop(reference value) {
+    if (size_.load(std::memory_order_acquire) == 0) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = Take();
+    return true;
+  }
+
+  template <typename Rep, typename Period>
+  bool pop_for(reference value,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    Spin();
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++waiters_;
+    bool ready = cv_.wait_until(lock, deadline,
+                                [this]() { return !queue_.empty(); });
+    --waiters_;
+    if (!ready) {
+      return false;
+    }
+    value = Take();
+    return true;
+  }
+
+  // ждет хотя бы один элемент, затем за один захват мьютекса переносит в
+  // out до max элементов; возвращает их число
+  template <typename OutputIt>
+  size_type drain_into(OutputIt out, size_type max) {
+    if (max == 0) {
+      return 0;
+    }
+    std::unique_lock<std::mutex> lock = WaitNonEmpty();
+    size_type count = 0;
+    for (; count < max && !queue_.empty(); ++count, ++out) {
+      *out = Take();
+    }
+    return count;
+  }
+
+  // из других потоков значения ниже -- лишь мгновенный снимок
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+
+ private:
+  s21::queue<value_type> queue_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_type waiters_ = 0;
+  std::atomic<size_type> size_{0};
+
+  // вызывается под мьютексом, сразу после того как в очередь положили count
+  // элементов; будит спящих потребителей уже после освобождения мьютекса
+  void Published(std::unique_lock<std::mutex> &lock, size_type count) {
+    size_.store(queue_.size(), std::memory_order_release);
+    bool has_waiters = waiters_ != 0;
+    lock.unlock();
+    if (!has_waiters || count == 0) {
+      return;
+    }
+    if (count == 1) {
+      cv_.notify_one();
+    } else {
+      cv_.notify_all();
+    }
+  }
+
+  // вызывается под мьютексом при непустой очереди
+  value_type Take() {
+    value_type value = queue_.pop_value();
+    size_.store(queue_.size(), std::memory_order_release);
+    return value;
+  }
+
+  void Spin() const noexcept {
+    Backoff backoff;
+    while (backoff.IsSpinning() && size_.load(std::memory_order_acquire) == 0) {
+      backoff.Pause();
+    }
+  }
+
+  std::unique_lock<std::mutex> WaitNonEmpty() {
+    Spin();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      ++waiters_;
+      cv_.wait(lock, [this]() { return !queue_.empty(); });
+      --waiters_;
+    }
+    return lock;
+  }
+};
+
+}  // namespace s21
+
+#endif
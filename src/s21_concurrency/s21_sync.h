@@ -0,0 +1,57 @@
+#ifndef SRC_21_SYNC_H
+#define SRC_21_SYNC_H
+
+#include <cstddef>
+#include <thread>
+
+namespace s21 {
+
+// индексы, которые пишут разные потоки, разносятся по отдельным кэш-линиям,
+// чтобы запись одного потока не выбивала линию у другого
+constexpr std::size_t kCacheLineSize = 64;
+
+// наименьшая степень двойки, не меньшая size (и не меньшая 2)
+inline std::size_t RoundUpToPowerOfTwo(std::size_t size) noexcept {
+  std::size_t capacity = 2;
+  while (capacity < size) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+// Ожидание с отступлением: первые шаги -- короткие паузы без ухода из
+// потока, дальше поток уступает процессор через yield
+class Backoff {
+ public:
+  void Pause() noexcept {
+    if (step_ < kSpinLimit) {
+      for (unsigned i = 0; i < (1u << step_); ++i) {
+        CpuRelax();
+      }
+      ++step_;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  bool IsSpinning() const noexcept { return step_ < kSpinLimit; }
+
+  void Reset() noexcept { step_ = 0; }
+
+ private:
+  static constexpr unsigned kSpinLimit = 7;
+
+  unsigned step_ = 0;
+
+  static void CpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_21_SYNC_H
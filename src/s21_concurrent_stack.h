@@ -0,0 +1,284 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "s21_concurrency/s21_sync.h"
+
+namespace s21 {
+
+// Стек Трайбера без блокировок. Узлы не выделяются по одному, а берутся из
+// собственного пула: пул растет кусками (каждый следующий вдвое больше) и не
+// возвращает память до уничтожения стека, поэтому узел можно адресовать
+// 32-битным индексом. Вершина стека и список свободных узлов хранятся как
+// 64-битное слово {тег, индекс}; тег увеличивается при каждой замене вершины,
+// что защищает CAS от проблемы ABA без двойного CAS.
+//
+// При неудачном CAS поток пробует встретиться с парным потоком в массиве
+// исключения: push отдает узел прямо в pop, минуя вершину стека.
+//
+// Без блокировок работают push и pop; мьютекс берется только при росте пула.
+template <typename T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  concurrent_stack() = default;
+
+  explicit concurrent_stack(size_type reserve) {
+    std::lock_guard<std::mutex> lock(grow_mutex_);
+    while (capacity_ < reserve) {
+      GrowBlock();
+    }
+  }
+
+  concurrent_stack(const concurrent_stack &other) = delete;
+  concurrent_stack &operator=(const concurrent_stack &other) = delete;
+
+  ~concurrent_stack() {
+    index_type index = IndexOf(head_.load(std::memory_order_acquire));
+    while (index != kNull) {
+      Node *node = At(index);
+      node->Value()->~value_type();
+      index = node->next.load(std::memory_order_relaxed);
+    }
+    for (size_type i = 0; i < kMaxChunks; ++i) {
+      delete[] chunks_[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    index_type index = AllocateNode();
+    try {
+      new (At(index)->storage) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      PushIndex(free_, index);
+      throw;
+    }
+    Backoff backoff;
+    while (!TryPushIndex(head_, index) && !TryEliminatePush(index)) {
+      backoff.Pause();
+    }
+  }
+
+  bool try_pop(reference value) {
+    Backoff backoff;
+    for (;;) {
+      bool contended = false;
+      index_type index = TryPopIndex(head_, contended);
+      if (index == kNull && contended) {
+        index = TryEliminatePop();
+      }
+      if (index != kNull) {
+        value_type *item = At(index)->Value();
+        value = std::move(*item);
+        item->~value_type();
+        PushIndex(free_, index);
+        return true;
+      }
+      if (!contended) {
+        return false;
+      }
+      backoff.Pause();
+    }
+  }
+
+  // из других потоков значение -- лишь мгновенный снимок
+  bool empty() const noexcept {
+    return IndexOf(head_.load(std::memory_order_acquire)) == kNull;
+  }
+
+ private:
+  using index_type = std::uint32_t;
+  using tagged_type = std::uint64_t;
+
+  static constexpr index_type kNull = ~index_type{0};
+  static constexpr size_type kFirstChunkBits = 6;
+  static constexpr size_type kFirstChunkSize = size_type{1}
+                                               << kFirstChunkBits;
+  static constexpr size_type kMaxChunks = 32 - kFirstChunkBits;
+  static constexpr size_type kEliminationSize = 8;
+  static constexpr int kEliminationSpins = 64;
+
+  struct Node {
+    std::atomic<index_type> next{kNull};
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  struct alignas(kCacheLineSize) Slot {
+    std::atomic<tagged_type> value{Pack(kNull, 0)};
+  };
+
+  alignas(kCacheLineSize) std::atomic<tagged_type> head_{Pack(kNull, 0)};
+  alignas(kCacheLineSize) std::atomic<tagged_type> free_{Pack(kNull, 0)};
+  Slot elimination_[kEliminationSize];
+
+  std::atomic<Node *> chunks_[kMaxChunks] = {};
+  size_type chunk_count_ = 0;
+  size_type capacity_ = 0;
+  std::mutex grow_mutex_;
+
+  static constexpr tagged_type Pack(index_type index, std::uint32_t tag) {
+    return (tagged_type{tag} << 32) | index;
+  }
+  static index_type IndexOf(tagged_type tagged) noexcept {
+    return static_cast<index_type>(tagged);
+  }
+  static std::uint32_t TagOf(tagged_type tagged) noexcept {
+    return static_cast<std::uint32_t>(tagged >> 32);
+  }
+
+  // кусок c содержит индексы [64 * (2^c - 1), 64 * (2^(c+1) - 1))
+  Node *At(index_type index) const noexcept {
+    size_type shifted = size_type{index} + kFirstChunkSize;
+    size_type chunk = 63 - __builtin_clzll(shifted) - kFirstChunkBits;
+    size_type offset = shifted - (kFirstChunkSize << chunk);
+    return chunks_[chunk].load(std::memory_order_acquire) + offset;
+  }
+
+  bool TryPushIndex(std::atomic<tagged_type> &top, index_type index) {
+    tagged_type old = top.load(std::memory_order_relaxed);
+    At(index)->next.store(IndexOf(old), std::memory_order_relaxed);
+    return top.compare_exchange_weak(old, Pack(index, TagOf(old) + 1),
+                                     std::memory_order_release,
+                                     std::memory_order_relaxed);
+  }
+
+  void PushIndex(std::atomic<tagged_type> &top, index_type index) {
+    while (!TryPushIndex(top, index)) {
+    }
+  }
+
+  // возвращает kNull, если стек пуст или CAS проиграл гонку (contended)
+  index_type TryPopIndex(std::atomic<tagged_type> &top, bool &contended) {
+    tagged_type old = top.load(std::memory_order_acquire);
+    index_type index = IndexOf(old);
+    if (index == kNull) {
+      return kNull;
+    }
+    index_type next = At(index)->next.load(std::memory_order_relaxed);
+    if (top.compare_exchange_strong(old, Pack(next, TagOf(old) + 1),
+                                    std::memory_order_acquire,
+                                    std::memory_order_relaxed)) {
+      return index;
+    }
+    contended = true;
+    return kNull;
+  }
+
+  index_type AllocateNode() {
+    for (;;) {
+      bool contended = false;
+      index_type index = TryPopIndex(free_, contended);
+      if (index != kNull) {
+        return index;
+      }
+      if (!contended) {
+        Grow();
+      }
+    }
+  }
+
+  // растит пул, только если другой поток не успел сделать это раньше
+  void Grow() {
+    std::lock_guard<std::mutex> lock(grow_mutex_);
+    if (IndexOf(free_.load(std::memory_order_acquire)) != kNull) {
+      return;
+    }
+    GrowBlock();
+  }
+
+  // добавляет в пул новый кусок узлов и целиком кладет его в список
+  // свободных; вызывается под grow_mutex_
+  void GrowBlock() {
+    if (chunk_count_ == kMaxChunks) {
+      throw std::length_error("\n concurrent_stack node pool exhausted\n");
+    }
+    size_type size = kFirstChunkSize << chunk_count_;
+    index_type first = static_cast<index_type>(capacity_);
+    Node *chunk = new Node[size];
+    for (size_type i = 0; i + 1 < size; ++i) {
+      chunk[i].next.store(first + static_cast<index_type>(i) + 1,
+                          std::memory_order_relaxed);
+    }
+    chunks_[chunk_count_].store(chunk, std::memory_order_release);
+    ++chunk_count_;
+    capacity_ += size;
+
+    Node *last = chunk + size - 1;
+    tagged_type old = free_.load(std::memory_order_relaxed);
+    do {
+      last->next.store(IndexOf(old), std::memory_order_relaxed);
+    } while (!free_.compare_exchange_weak(old, Pack(first, TagOf(old) + 1),
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+  }
+
+  static Slot &RandomSlot(Slot *slots) noexcept {
+    thread_local std::uint32_t state = static_cast<std::uint32_t>(
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return slots[state % kEliminationSize];
+  }
+
+  // выставляет узел в ячейку исключения и ждет, не заберет ли его pop
+  bool TryEliminatePush(index_type index) {
+    std::atomic<tagged_type> &slot = RandomSlot(elimination_).value;
+    tagged_type seen = slot.load(std::memory_order_relaxed);
+    if (IndexOf(seen) != kNull) {
+      return false;
+    }
+    tagged_type offered = Pack(index, TagOf(seen) + 1);
+    if (!slot.compare_exchange_strong(seen, offered,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    for (int i = 0; i < kEliminationSpins; ++i) {
+      if (slot.load(std::memory_order_relaxed) != offered) {
+        return true;
+      }
+    }
+    return !slot.compare_exchange_strong(
+        offered, Pack(kNull, TagOf(offered) + 1), std::memory_order_relaxed);
+  }
+
+  index_type TryEliminatePop() {
+    std::atomic<tagged_type> &slot = RandomSlot(elimination_).value;
+    tagged_type seen = slot.load(std::memory_order_acquire);
+    if (IndexOf(seen) == kNull) {
+      return kNull;
+    }
+    if (slot.compare_exchange_strong(seen, Pack(kNull, TagOf(seen) + 1),
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      return IndexOf(seen);
+    }
+    return kNull;
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -2,6 +2,19 @@
 #define SRC_21_CONTAINERSPLUS_H
 
 #include "s21_array.h"
+#include "s21_blocking_queue.h"
+#include "s21_concurrent_stack.h"
+#include "s21_deque.h"
+#include "s21_forward_list.h"
+#include "s21_lru_cache.h"
+#include "s21_mpmc_queue.h"
+#include "s21_mpsc_queue.h"
+#include "s21_multicast_ring_buffer.h"
 #include "s21_multiset.h"
+#include "s21_priority_queue.h"
+#include "s21_spsc_queue.h"
+#include "s21_thread_pool.h"
+#include "s21_timer_wheel.h"
+#include "s21_work_stealing_deque.h"
 
 #endif
@@ -0,0 +1,399 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Двусторонняя очередь из блоков фиксированного размера. Карта -- массив
+// указателей на блоки; элементы занимают непрерывный диапазон "виртуальных"
+// ячеек [start_, start_ + size_), ячейка slot лежит в блоке slot / kBlockSize.
+// Блоки выделяются лениво и освобождаются, как только опустеют, но один
+// освобожденный блок остается про запас, чтобы push/pop на границе блока не
+// выделяли и не освобождали память каждый раз. Элементы при росте не
+// перемещаются: растет или перецентрируется только карта.
+template <typename T>
+class deque {
+  template <bool IsConst>
+  class BasicIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = BasicIterator<false>;
+  using const_iterator = BasicIterator<true>;
+
+  deque() = default;
+
+  deque(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) {
+      push_back(item);
+    }
+  }
+
+  deque(const deque &other) {
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(other[i]);
+    }
+  }
+
+  deque(deque &&other) noexcept { swap(other); }
+
+  deque &operator=(const deque &other) {
+    if (this != &other) {
+      deque copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  deque &operator=(deque &&other) noexcept {
+    if (this != &other) {
+      deque empty;
+      swap(empty);
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~deque() {
+    clear();
+    Deallocate(spare_);
+    delete[] map_;
+  }
+
+  reference operator[](size_type pos) { return *Address(start_ + pos); }
+  const_reference operator[](size_type pos) const {
+    return *Address(start_ + pos);
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("\n index out of range\n");
+    }
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("\n index out of range\n");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() {
+    assert(size_ != 0);
+    return (*this)[0];
+  }
+  const_reference front() const {
+    assert(size_ != 0);
+    return (*this)[0];
+  }
+
+  reference back() {
+    assert(size_ != 0);
+    return (*this)[size_ - 1];
+  }
+  const_reference back() const {
+    assert(size_ != 0);
+    return (*this)[size_ - 1];
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void clear() noexcept {
+    while (size_ != 0) {
+      pop_back();
+    }
+    start_ = map_size_ / 2 * kBlockSize;
+  }
+
+  // отдает запасной блок
+  void shrink_to_fit() noexcept {
+    Deallocate(spare_);
+    spare_ = nullptr;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if ((start_ + size_) / kBlockSize >= map_size_) {
+      ReserveMap();
+    }
+    value_type *place = Construct(start_ + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *place;
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (start_ == 0) {
+      ReserveMap();
+    }
+    value_type *place = Construct(start_ - 1, std::forward<Args>(args)...);
+    --start_;
+    ++size_;
+    return *place;
+  }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    size_type slot = start_ + size_ - 1;
+    Address(slot)->~value_type();
+    --size_;
+    if (size_ == 0 || slot % kBlockSize == 0) {
+      ReleaseBlock(slot / kBlockSize);
+    }
+  }
+
+  void pop_front() {
+    if (size_ == 0) return;
+    Address(start_)->~value_type();
+    --size_;
+    ++start_;
+    if (size_ == 0 || start_ % kBlockSize == 0) {
+      ReleaseBlock((start_ - 1) / kBlockSize);
+    }
+  }
+
+  void swap(deque &other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(spare_, other.spare_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (push_front(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  static constexpr size_type kBlockBytes = 512;
+  static constexpr size_type kMinMapSize = 8;
+
+  // степень двойки, чтобы деление и остаток сводились к сдвигу и маске
+  static constexpr size_type BlockSize() {
+    size_type size = 16;
+    while (size * 2 * sizeof(value_type) <= kBlockBytes) {
+      size *= 2;
+    }
+    return size;
+  }
+
+  static constexpr size_type kBlockSize = BlockSize();
+
+  value_type **map_ = nullptr;
+  size_type map_size_ = 0;
+  value_type *spare_ = nullptr;
+  size_type start_ = 0;
+  size_type size_ = 0;
+
+  value_type *Address(size_type slot) const noexcept {
+    return map_[slot / kBlockSize] + slot % kBlockSize;
+  }
+
+  static value_type *Allocate() {
+    return static_cast<value_type *>(
+        ::operator new(kBlockSize * sizeof(value_type)));
+  }
+
+  static void Deallocate(value_type *block) noexcept {
+    ::operator delete(block);
+  }
+
+  template <typename... Args>
+  value_type *Construct(size_type slot, Args &&...args) {
+    size_type block = slot / kBlockSize;
+    bool fresh = map_[block] == nullptr;
+    if (fresh) {
+      if (spare_ != nullptr) {
+        map_[block] = spare_;
+        spare_ = nullptr;
+      } else {
+        map_[block] = Allocate();
+      }
+    }
+    value_type *place = Address(slot);
+    try {
+      new (place) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      if (fresh) {
+        ReleaseBlock(block);
+      }
+      throw;
+    }
+    return place;
+  }
+
+  void ReleaseBlock(size_type block) noexcept {
+    if (spare_ == nullptr) {
+      spare_ = map_[block];
+    } else {
+      Deallocate(map_[block]);
+    }
+    map_[block] = nullptr;
+  }
+
+  // освобождает по краям карты хотя бы по одному блоку: если занята не
+  // больше половины карты, блоки просто сдвигаются к центру, иначе карта
+  // удваивается
+  void ReserveMap() {
+    size_type first = start_ / kBlockSize;
+    size_type used =
+        size_ == 0 ? 0 : (start_ + size_ - 1) / kBlockSize - first + 1;
+    size_type new_size = map_size_;
+    while (new_size < used * 2 + 2 || new_size < kMinMapSize) {
+      new_size = new_size == 0 ? kMinMapSize : new_size * 2;
+    }
+    size_type new_first = (new_size - used) / 2;
+
+    if (new_size == map_size_) {
+      std::memmove(map_ + new_first, map_ + first, used * sizeof(*map_));
+    } else {
+      value_type **map = new value_type *[new_size];
+      std::copy(map_ + first, map_ + first + used, map + new_first);
+      delete[] map_;
+      map_ = map;
+      map_size_ = new_size;
+    }
+    std::fill(map_, map_ + new_first, nullptr);
+    std::fill(map_ + new_first + used, map_ + map_size_, nullptr);
+    start_ = new_first * kBlockSize + start_ % kBlockSize;
+  }
+};
+
+// итератор произвольного доступа: пара (дек, индекс)
+template <typename T>
+template <bool IsConst>
+class deque<T>::BasicIterator {
+  using owner_type = std::conditional_t<IsConst, const deque, deque>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const T *, T *>;
+  using reference = std::conditional_t<IsConst, const T &, T &>;
+
+  BasicIterator() = default;
+
+  BasicIterator(owner_type *owner, size_type index)
+      : owner_(owner), index_(index) {}
+
+  // iterator неявно превращается в const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  BasicIterator(const BasicIterator<OtherConst> &other)
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return &(*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+
+  BasicIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+  BasicIterator operator++(int) {
+    BasicIterator copy = *this;
+    ++index_;
+    return copy;
+  }
+  BasicIterator &operator--() {
+    --index_;
+    return *this;
+  }
+  BasicIterator operator--(int) {
+    BasicIterator copy = *this;
+    --index_;
+    return copy;
+  }
+
+  BasicIterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  BasicIterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+  BasicIterator operator+(difference_type n) const {
+    return BasicIterator(owner_, index_ + n);
+  }
+  friend BasicIterator operator+(difference_type n, const BasicIterator &it) {
+    return it + n;
+  }
+  BasicIterator operator-(difference_type n) const {
+    return BasicIterator(owner_, index_ - n);
+  }
+  difference_type operator-(const BasicIterator &other) const {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  bool operator==(const BasicIterator &other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const BasicIterator &other) const {
+    return index_ != other.index_;
+  }
+  bool operator<(const BasicIterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const BasicIterator &other) const {
+    return index_ > other.index_;
+  }
+  bool operator<=(const BasicIterator &other) const {
+    return index_ <= other.index_;
+  }
+  bool operator>=(const BasicIterator &other) const {
+    return index_ >= other.index_;
+  }
+
+ private:
+  template <bool>
+  friend class BasicIterator;
+
+  owner_type *owner_ = nullptr;
+  size_type index_ = 0;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,382 @@
+#ifndef S21_FORWARD_LIST_H
+#define S21_FORWARD_LIST_H
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace s21 {
+
+template <typename T>
+class forward_list {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+ private:
+  // before_begin() указывает на node_base внутри самого списка, поэтому
+  // у него нет поля data
+  struct node_base {
+    node_base* next = nullptr;
+  };
+
+  struct node : node_base {
+    value_type data;
+
+    template <typename... Args>
+    explicit node(Args&&... args) : data(std::forward<Args>(args)...) {}
+  };
+
+  node_base m_head;
+  size_type m_size = 0;
+
+ public:
+  class ConstIterator {
+   private:
+    explicit ConstIterator(const node_base* ptr) noexcept : m_current{ptr} {}
+
+    friend class forward_list;
+
+   public:
+    using difference_type = forward_list::difference_type;
+    using value_type = forward_list::value_type;
+    using pointer = forward_list::const_pointer;
+    using reference = forward_list::const_reference;
+    using iterator_category = std::forward_iterator_tag;
+
+    ConstIterator() noexcept : m_current{nullptr} {}
+
+    reference operator*() const noexcept {
+      assert(m_current != nullptr);
+      return static_cast<const node*>(m_current)->data;
+    }
+
+    ConstIterator& operator++() noexcept {
+      assert(m_current != nullptr);
+      m_current = m_current->next;
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(ConstIterator other) const noexcept {
+      return m_current == other.m_current;
+    }
+
+    bool operator!=(ConstIterator other) const noexcept {
+      return !(*this == other);
+    }
+
+   protected:
+    const node_base* m_current;
+    node_base* Get() const noexcept {
+      return const_cast<node_base*>(m_current);
+    }
+  };
+
+  class Iterator : public ConstIterator {
+   private:
+    friend class forward_list;
+
+    explicit Iterator(node_base* ptr) noexcept : ConstIterator{ptr} {}
+
+   public:
+    using difference_type = forward_list::difference_type;
+    using value_type = forward_list::value_type;
+    using pointer = forward_list::pointer;
+    using reference = forward_list::reference;
+    using iterator_category = std::forward_iterator_tag;
+
+    Iterator() noexcept : ConstIterator{} {}
+
+    reference operator*() const noexcept {
+      return const_cast<reference>(ConstIterator::operator*());
+    }
+
+    Iterator& operator++() noexcept {
+      ConstIterator::operator++();
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+  };
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  forward_list() = default;
+
+  explicit forward_list(size_type n) {
+    for (size_type i = 0; i < n; ++i) {
+      push_front(value_type());
+    }
+  }
+
+  forward_list(std::initializer_list<value_type> items) {
+    AppendCopy(items.begin(), items.end());
+  }
+
+  forward_list(const forward_list& other) {
+    AppendCopy(other.begin(), other.end());
+  }
+
+  forward_list(forward_list&& other) noexcept { swap(other); }
+
+  forward_list& operator=(const forward_list& other) {
+    if (this != &other) {
+      forward_list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  forward_list& operator=(forward_list&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~forward_list() { clear(); }
+
+  reference front() {
+    assert(m_head.next != nullptr);
+    return static_cast<node*>(m_head.next)->data;
+  }
+
+  const_reference front() const {
+    assert(m_head.next != nullptr);
+    return static_cast<const node*>(m_head.next)->data;
+  }
+
+  iterator before_begin() noexcept { return iterator{&m_head}; }
+  const_iterator before_begin() const noexcept {
+    return const_iterator{&m_head};
+  }
+  const_iterator cbefore_begin() const noexcept {
+    return const_iterator{&m_head};
+  }
+
+  iterator begin() noexcept { return iterator{m_head.next}; }
+  iterator end() noexcept { return iterator{nullptr}; }
+  const_iterator begin() const noexcept { return const_iterator{m_head.next}; }
+  const_iterator end() const noexcept { return const_iterator{nullptr}; }
+  const_iterator cbegin() const noexcept {
+    return const_iterator{m_head.next};
+  }
+  const_iterator cend() const noexcept { return const_iterator{nullptr}; }
+
+  bool empty() const noexcept { return m_head.next == nullptr; }
+  size_type size() const noexcept { return m_size; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(node);
+  }
+
+  void clear() noexcept {
+    while (m_head.next) {
+      pop_front();
+    }
+  }
+
+  void push_front(const_reference item) { emplace_after(before_begin(), item); }
+  void push_front(value_type&& item) {
+    emplace_after(before_begin(), std::move(item));
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_front() {
+    if (m_head.next) {
+      erase_after(before_begin());
+    }
+  }
+
+  iterator insert_after(const_iterator pos, const_reference item) {
+    return emplace_after(pos, item);
+  }
+  iterator insert_after(const_iterator pos, value_type&& item) {
+    return emplace_after(pos, std::move(item));
+  }
+
+  template <typename... Args>
+  iterator emplace_after(const_iterator pos, Args&&... args) {
+    node_base* prev = pos.Get();
+    assert(prev != nullptr);
+    node* new_node = new node(std::forward<Args>(args)...);
+    new_node->next = prev->next;
+    prev->next = new_node;
+    m_size++;
+    return iterator{new_node};
+  }
+
+  iterator erase_after(const_iterator pos) noexcept {
+    node_base* prev = pos.Get();
+    assert(prev != nullptr && prev->next != nullptr);
+    node* victim = static_cast<node*>(prev->next);
+    prev->next = victim->next;
+    delete victim;
+    m_size--;
+    return iterator{prev->next};
+  }
+
+  // переносит все узлы other сразу после pos, без копирования элементов
+  void splice_after(const_iterator pos, forward_list& other) noexcept {
+    if (other.empty() || this == &other) {
+      return;
+    }
+    node_base* prev = pos.Get();
+    node_base* last = &other.m_head;
+    while (last->next) {
+      last = last->next;
+    }
+    last->next = prev->next;
+    prev->next = other.m_head.next;
+    m_size += other.m_size;
+
+    other.m_head.next = nullptr;
+    other.m_size = 0;
+  }
+
+  // переносит один узел, следующий за it, сразу после pos
+  void splice_after(const_iterator pos, forward_list& other,
+                    const_iterator it) noexcept {
+    node_base* prev = pos.Get();
+    node_base* before_moved = it.Get();
+    node_base* moved = before_moved->next;
+    if (moved == nullptr || prev == before_moved || prev == moved) {
+      return;
+    }
+    before_moved->next = moved->next;
+    moved->next = prev->next;
+    prev->next = moved;
+    other.m_size--;
+    m_size++;
+  }
+
+  void swap(forward_list& other) noexcept {
+    std::swap(m_head.next, other.m_head.next);
+    std::swap(m_size, other.m_size);
+  }
+
+  void reverse() noexcept {
+    node_base* prev_node = nullptr;
+    node_base* cur = m_head.next;
+    while (cur) {
+      node_base* next_node = cur->next;
+      cur->next = prev_node;
+      prev_node = cur;
+      cur = next_node;
+    }
+    m_head.next = prev_node;
+  }
+
+  // если operator< бросит, все узлы остаются в списке в неопределенном
+  // порядке
+  void sort() { MergeSort(m_head.next, m_size); }
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    for (const auto& arg : {args...}) {
+      push_front(arg);
+    }
+  }
+
+ private:
+  template <typename InputIt>
+  void AppendCopy(InputIt first, InputIt last) {
+    node_base* tail = &m_head;
+    for (; first != last; ++first) {
+      tail = insert_after(const_iterator{tail}, *first).Get();
+    }
+  }
+
+  static bool Less(const node_base* left, const node_base* right) {
+    return static_cast<const node*>(left)->data <
+           static_cast<const node*>(right)->data;
+  }
+
+  // дописывает цепочку tail в конец цепочки chain
+  static node_base* Concat(node_base* chain, node_base* tail) noexcept {
+    if (!chain) return tail;
+    node_base* last = chain;
+    while (last->next) last = last->next;
+    last->next = tail;
+    return chain;
+  }
+
+  // сортирует на месте цепочку из count узлов, начинающуюся с first;
+  // сортировка устойчивая, равные элементы сохраняют исходный порядок. Если
+  // сравнение бросит, first все равно указывает на цепочку из всех count
+  // узлов
+  static void MergeSort(node_base*& first, size_type count) {
+    if (count <= 1) {
+      if (first) first->next = nullptr;
+      return;
+    }
+    size_type left_count = count / 2;
+    node_base* left_last = first;
+    for (size_type i = 1; i < left_count; ++i) {
+      left_last = left_last->next;
+    }
+    node_base* right = left_last->next;
+    left_last->next = nullptr;
+    node_base* left = first;
+    try {
+      MergeSort(right, count - left_count);
+    } catch (...) {
+      left_last->next = right;
+      throw;
+    }
+    try {
+      MergeSort(left, left_count);
+    } catch (...) {
+      first = Concat(left, right);
+      throw;
+    }
+
+    node_base merged;
+    node_base* tail = &merged;
+    try {
+      while (left && right) {
+        if (Less(right, left)) {
+          tail->next = right;
+          right = right->next;
+        } else {
+          tail->next = left;
+          left = left->next;
+        }
+        tail = tail->next;
+      }
+    } catch (...) {
+      tail->next = Concat(left, right);
+      first = merged.next;
+      throw;
+    }
+    tail->next = left ? left : right;
+    first = merged.next;
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -1,11 +1,17 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
 
+#include "s21_thread_pool.h"
 #include "stdio.h"
 
 namespace s21 {
@@ -29,7 +35,8 @@ class list {
     node* prev = nullptr;
     value_type data;
 
-    node(const_reference item) noexcept : data{item} {};
+    template <typename... Args>
+    explicit node(Args&&... args) : data(std::forward<Args>(args)...) {}
   };
 
   size_type m_size = 0;
@@ -44,6 +51,8 @@ class list {
     friend class list;
 
    public:
+    ConstIterator() noexcept : m_current{nullptr} {}
+
     using difference_type = list::difference_type;
     using value_type = list::value_type;
     using pointer = list::const_pointer;
@@ -108,6 +117,8 @@ class list {
     explicit Iterator(node* ptr) noexcept : ConstIterator{ptr} {}
 
    public:
+    Iterator() noexcept : ConstIterator{} {}
+
     using difference_type = list::difference_type;
     using value_type = list::value_type;
     using pointer = list::pointer;
@@ -194,8 +205,12 @@ class list {
     }
   }
 
-  void push_front(const_reference item) {
-    auto new_node = new node{item};
+  void push_front(const_reference item) { emplace_front(item); }
+  void push_front(value_type&& item) { emplace_front(std::move(item)); }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    auto new_node = new node(std::forward<Args>(args)...);
     if (head) {
       head->prev = new_node;
       new_node->next = head;
@@ -204,9 +219,15 @@ class list {
       head = tail = new_node;
     }
     m_size++;
+    return new_node->data;
   }
-  void push_back(const_reference item) {
-    auto new_node = new node{item};
+
+  void push_back(const_reference item) { emplace_back(item); }
+  void push_back(value_type&& item) { emplace_back(std::move(item)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    auto new_node = new node(std::forward<Args>(args)...);
     if (tail) {
       tail->next = new_node;
       new_node->prev = tail;
@@ -216,6 +237,7 @@ class list {
       head = new_node;
     }
     m_size++;
+    return new_node->data;
   }
 
   void insert(const_iterator place, const_reference item) {
@@ -255,15 +277,72 @@ class list {
     m_size--;
   }
 
-  const_reference front() {
-    const_reference tmp = head->data;
-    return tmp;
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    node* from = const_cast<node*>(first.Get());
+    node* to = const_cast<node*>(last.Get());
+    if (from == to) {
+      return iterator{to};
+    }
+
+    size_type count = 1;
+    node* run_last = from;
+    while (run_last->next != to) {
+      run_last = run_last->next;
+      count++;
+    }
+    Relink(from->prev, to);
+    run_last->next = nullptr;
+    m_size -= count;
+    FreeChain(from);
+    return iterator{to};
+  }
+
+  size_type remove(const_reference item) {
+    return remove_if([&item](const_reference data) { return data == item; });
   }
-  const_reference back() {
-    const_reference tmp = tail->data;
-    return tmp;
+
+  // подряд идущие подходящие узлы вырезаются одной перелинковкой и
+  // складываются в общую цепочку, которая освобождается в конце. pred
+  // вызывается ровно один раз для каждого элемента: узел, на котором
+  // оборвалась серия, уже проверен и пропускается
+  template <typename Predicate>
+  size_type remove_if(Predicate pred) {
+    node* garbage = nullptr;
+    size_type removed = 0;
+    node* cur = head;
+    try {
+      while (cur) {
+        if (!pred(cur->data)) {
+          cur = cur->next;
+          continue;
+        }
+        node* run_last = cur;
+        size_type count = 1;
+        while (run_last->next && pred(run_last->next->data)) {
+          run_last = run_last->next;
+          count++;
+        }
+        node* after = run_last->next;
+        Relink(cur->prev, after);
+        m_size -= count;
+        removed += count;
+        run_last->next = garbage;
+        garbage = cur;
+        cur = after ? after->next : nullptr;
+      }
+    } catch (...) {
+      FreeChain(garbage);
+      throw;
+    }
+    FreeChain(garbage);
+    return removed;
   }
 
+  reference front() { return head->data; }
+  const_reference front() const { return head->data; }
+  reference back() { return tail->data; }
+  const_reference back() const { return tail->data; }
+
   const_iterator begin() const noexcept { return const_iterator{head}; }
   const_iterator end() const noexcept { return const_iterator{nullptr}; }
   const_iterator cbegin() const noexcept { return const_iterator{head}; }
@@ -314,32 +393,51 @@ class list {
 
     node* this_head = nullptr;
     node* this_tail = nullptr;
-    value_type this_size = 0;
-
-    while (left_node != nullptr || right_node != nullptr) {
-      node* next_node;
-
-      bool choose_left =
-          (right_node == nullptr ||
-           (left_node != nullptr && left_node->data <= right_node->data));
-
-      if (choose_left) {
-        next_node = left_node;
-        left_node = left_node->next;
-      } else {
-        next_node = right_node;
-        right_node = right_node->next;
+    size_type this_size = 0;
+
+    std::exception_ptr error;
+    try {
+      while (left_node != nullptr || right_node != nullptr) {
+        node* next_node;
+
+        bool choose_left =
+            (right_node == nullptr ||
+             (left_node != nullptr && left_node->data <= right_node->data));
+
+        if (choose_left) {
+          next_node = left_node;
+          left_node = left_node->next;
+        } else {
+          next_node = right_node;
+          right_node = right_node->next;
+        }
+
+        if (node_tmp != nullptr) {
+          node_tmp->next = next_node;
+          next_node->prev = node_tmp;
+        } else {
+          this_head = next_node;
+          next_node->prev = nullptr;
+        }
+
+        node_tmp = next_node;
       }
-
-      if (node_tmp != nullptr) {
-        node_tmp->next = next_node;
-        next_node->prev = node_tmp;
-      } else {
-        this_head = next_node;
-        next_node->prev = nullptr;
+    } catch (...) {
+      // сравнение бросило: к слитому началу дописываются остатки обоих
+      // списков, чтобы ни один узел не потерялся
+      error = std::current_exception();
+      for (node* rest : {left_node, right_node}) {
+        if (rest == nullptr) {
+          continue;
+        }
+        if (node_tmp != nullptr) {
+          node_tmp->next = rest;
+        } else {
+          this_head = rest;
+        }
+        rest->prev = node_tmp;
+        node_tmp = (rest == left_node) ? left.tail : right.tail;
       }
-
-      node_tmp = next_node;
     }
 
     this_tail = node_tmp;
@@ -356,6 +454,9 @@ class list {
     head = this_head;
     tail = this_tail;
     m_size = this_size;
+    if (error) {
+      std::rethrow_exception(error);
+    }
   }
 
   void merge(list& other) { merge_sort(*this, other); }
@@ -365,9 +466,8 @@ class list {
       return;
     }
 
-    node* before =
-        (pos == begin()) ? nullptr : const_cast<node*>(pos.Get())->prev;
-    node* after = (pos == end()) ? nullptr : const_cast<node*>(pos.Get());
+    node* after = const_cast<node*>(pos.Get());
+    node* before = after ? after->prev : tail;
     if (before) {
       before->next = other.head;
     } else {
@@ -388,6 +488,42 @@ class list {
     other.head = nullptr;
     other.tail = nullptr;
   }
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    node* moved = const_cast<node*>(it.Get());
+    node* after = const_cast<node*>(pos.Get());
+    assert(moved != nullptr);
+    if (moved == after || (this == &other && moved->next == after)) {
+      return;
+    }
+
+    if (moved->prev) {
+      moved->prev->next = moved->next;
+    } else {
+      other.head = moved->next;
+    }
+    if (moved->next) {
+      moved->next->prev = moved->prev;
+    } else {
+      other.tail = moved->prev;
+    }
+    other.m_size--;
+
+    node* before = after ? after->prev : tail;
+    moved->prev = before;
+    moved->next = after;
+    if (before) {
+      before->next = moved;
+    } else {
+      head = moved;
+    }
+    if (after) {
+      after->prev = moved;
+    } else {
+      tail = moved;
+    }
+    m_size++;
+  }
+
   void reverse() {
     if (m_size > 1) {
       node* cur = head;
@@ -448,13 +584,87 @@ class list {
 
     middle->next = nullptr;
     right_half.head->prev = nullptr;
+    head = tail = nullptr;
+    m_size = 0;
 
-    left_half.sort();
-    right_half.sort();
+    try {
+      left_half.sort();
+      right_half.sort();
+    } catch (...) {
+      splice(end(), left_half);
+      splice(end(), right_half);
+      throw;
+    }
 
     merge_sort(left_half, right_half);
   }
 
+  // списки короче порога сортируются последовательно: на них запуск потоков
+  // обходится дороже самой сортировки
+  static constexpr size_type kParallelSortThreshold = 1 << 16;
+  // кусок короче этого не стоит отдельной задачи
+  static constexpr size_type kMinParallelRun = 1 << 12;
+
+  // список режется на max_runs кусков (0 -- по числу аппаратных потоков),
+  // которые сортируются и попарно сливаются задачами
+  // s21::default_thread_pool(); число потоков задает сам пул. Если сравнение
+  // бросит исключение, все узлы возвращаются в список (в неопределенном
+  // порядке) и исключение пробрасывается дальше
+  void parallel_sort(size_type max_runs = 0) {
+    size_type runs_count =
+        max_runs ? max_runs : thread::hardware_concurrency();
+    runs_count = std::min(runs_count, m_size / kMinParallelRun);
+    if (m_size < kParallelSortThreshold || runs_count < 2) {
+      sort();
+      return;
+    }
+
+    // режем список на runs_count кусков, перевешивая узлы без копирования
+    std::unique_ptr<list[]> runs(new list[runs_count]);
+    size_type run_size = m_size / runs_count;
+    node* cur = head;
+    for (size_type i = 0; i < runs_count; ++i) {
+      size_type count =
+          (i + 1 == runs_count) ? m_size - run_size * i : run_size;
+      runs[i].head = cur;
+      runs[i].m_size = count;
+      for (size_type j = 1; j < count; ++j) {
+        cur = cur->next;
+      }
+      runs[i].tail = cur;
+      cur = cur->next;
+      runs[i].head->prev = nullptr;
+      runs[i].tail->next = nullptr;
+    }
+    head = tail = nullptr;
+    m_size = 0;
+
+    thread_pool& pool = default_thread_pool();
+    try {
+      pool.parallel_for(
+          size_type{0}, runs_count, [&runs](size_type i) { runs[i].sort(); },
+          1);
+
+      // попарное слияние отсортированных кусков деревом, уровень за уровнем
+      for (size_type step = 1; step < runs_count; step *= 2) {
+        size_type pairs = (runs_count - step - 1) / (step * 2) + 1;
+        pool.parallel_for(
+            size_type{0}, pairs,
+            [&runs, step](size_type pair) {
+              size_type i = pair * step * 2;
+              runs[i].merge_sort(runs[i], runs[i + step]);
+            },
+            1);
+      }
+    } catch (...) {
+      for (size_type i = 0; i < runs_count; ++i) {
+        splice(end(), runs[i]);
+      }
+      throw;
+    }
+    swap(runs[0]);
+  }
+
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args) {
     iterator place = iterator{const_cast<node*>(pos.Get())};
@@ -477,6 +687,29 @@ class list {
       push_front(arg);
     }
   }
+
+ private:
+  // соединяет before и after, выбрасывая все узлы между ними
+  void Relink(node* before, node* after) noexcept {
+    if (before) {
+      before->next = after;
+    } else {
+      head = after;
+    }
+    if (after) {
+      after->prev = before;
+    } else {
+      tail = before;
+    }
+  }
+
+  static void FreeChain(node* chain) noexcept {
+    while (chain) {
+      node* next_node = chain->next;
+      delete chain;
+      chain = next_node;
+    }
+  }
 };
 }  // namespace s21
 #endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef SRC_21_LRU_CACHE_H
+#define SRC_21_LRU_CACHE_H
+
+#include <functional>
+#include <utility>
+
+#include "s21_list.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+template <typename Key, typename Value>
+class lru_cache {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+  using weigher_type =
+      std::function<size_type(const key_type &, const mapped_type &)>;
+  using eviction_callback =
+      std::function<void(const key_type &, const mapped_type &)>;
+
+  // capacity задает максимальный суммарный вес записей; без weigher вес
+  // каждой записи равен 1, то есть capacity -- это число записей
+  explicit lru_cache(size_type capacity, weigher_type weigher = nullptr,
+                     eviction_callback on_evict = nullptr)
+      : capacity_(capacity),
+        weigher_(std::move(weigher)),
+        on_evict_(std::move(on_evict)) {}
+
+  lru_cache(const lru_cache &other) = delete;
+  lru_cache &operator=(const lru_cache &other) = delete;
+
+  ~lru_cache() = default;
+
+  // при попадании запись становится самой свежей; nullptr -- промах
+  mapped_type *get(const key_type &key) {
+    entry_iterator *place = Lookup(key);
+    if (place == nullptr) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, *place);
+    return &(**place).value;
+  }
+
+  void put(const key_type &key, const mapped_type &value) {
+    size_type weight = Weigh(key, value);
+    entry_iterator *place = Lookup(key);
+    if (place != nullptr) {
+      entry &item = **place;
+      weight_ = weight_ - item.weight + weight;
+      item.value = value;
+      item.weight = weight;
+      entries_.splice(entries_.begin(), entries_, *place);
+    } else {
+      entries_.push_front(entry{key, value, weight});
+      index_.insert(key, entries_.begin());
+      weight_ += weight;
+    }
+    EvictOverflow();
+  }
+
+  // освежает запись, не трогая счетчики попаданий и промахов
+  bool touch(const key_type &key) {
+    entry_iterator *place = Lookup(key);
+    if (place == nullptr) {
+      return false;
+    }
+    entries_.splice(entries_.begin(), entries_, *place);
+    return true;
+  }
+
+  bool contains(const key_type &key) { return index_.contains(key); }
+
+  bool erase(const key_type &key) {
+    entry_iterator *place = Lookup(key);
+    if (place == nullptr) {
+      return false;
+    }
+    entry_iterator item = *place;
+    weight_ -= (*item).weight;
+    index_.erase(index_.find(key));
+    entries_.erase(item);
+    return true;
+  }
+
+  void clear() {
+    index_.clear();
+    entries_.clear();
+    weight_ = 0;
+  }
+
+  void set_eviction_callback(eviction_callback on_evict) {
+    on_evict_ = std::move(on_evict);
+  }
+
+  void set_capacity(size_type capacity) {
+    capacity_ = capacity;
+    EvictOverflow();
+  }
+
+  bool empty() { return entries_.empty(); }
+  size_type size() { return entries_.size(); }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type weight() const noexcept { return weight_; }
+
+  size_type hits() const noexcept { return hits_; }
+  size_type misses() const noexcept { return misses_; }
+  size_type evictions() const noexcept { return evictions_; }
+
+  void reset_stats() noexcept { hits_ = misses_ = evictions_ = 0; }
+
+ private:
+  struct entry {
+    key_type key;
+    mapped_type value;
+    size_type weight;
+  };
+
+  using entry_list = s21::list<entry>;
+  using entry_iterator = typename entry_list::iterator;
+
+  // записи упорядочены от самой свежей к самой старой
+  entry_list entries_;
+  s21::map<key_type, entry_iterator> index_;
+  size_type capacity_;
+  size_type weight_ = 0;
+  weigher_type weigher_;
+  eviction_callback on_evict_;
+
+  size_type hits_ = 0;
+  size_type misses_ = 0;
+  size_type evictions_ = 0;
+
+  entry_iterator *Lookup(const key_type &key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    return &(*it).second;
+  }
+
+  size_type Weigh(const key_type &key, const mapped_type &value) const {
+    return weigher_ ? weigher_(key, value) : 1;
+  }
+
+  void EvictOverflow() {
+    while (weight_ > capacity_ && !entries_.empty()) {
+      const entry &oldest = entries_.back();
+      if (on_evict_) {
+        on_evict_(oldest.key, oldest.value);
+      }
+      weight_ -= oldest.weight;
+      index_.erase(index_.find(oldest.key));
+      entries_.pop_back();
+      ++evictions_;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_21_LRU_CACHE_H
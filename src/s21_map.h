@@ -1,25 +1,51 @@
 #ifndef SRC_21_MAP_H
 #define SRC_21_MAP_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "s21_binary_tree/s21_tree.h"
 
 namespace s21 {
 
-template <typename Key, typename Value>
+// сравнивает пары по ключу с помощью KeyCompare; перегрузки с одним ключом
+// позволяют искать место в дереве, не строя пару
+template <typename Key, typename Value, typename KeyCompare = std::less<Key>>
 struct MapCompare {
   using value_type = std::pair<Key, Value>;
+  KeyCompare compare;
+
   bool operator()(const value_type &pair1,
                   const value_type &pair2) const noexcept {
-    return pair1.first < pair2.first;
+    return compare(pair1.first, pair2.first);
+  }
+  bool operator()(const Key &key, const value_type &pair) const noexcept {
+    return compare(key, pair.first);
+  }
+  bool operator()(const value_type &pair, const Key &key) const noexcept {
+    return compare(pair.first, key);
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  bool operator()(const K &key, const value_type &pair) const {
+    return compare(key, pair.first);
+  }
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  bool operator()(const value_type &pair, const K &key) const {
+    return compare(pair.first, key);
   }
 };
 
-template <typename Key, typename Value>
-class map : public RBTree<std::pair<Key, Value>, MapCompare<Key, Value>> {
+template <typename Key, typename Value, typename KeyCompare = std::less<Key>>
+class map
+    : public RBTree<std::pair<Key, Value>, MapCompare<Key, Value, KeyCompare>> {
  public:
   using key_type = Key;
   using mapped_type = Value;
@@ -27,10 +53,12 @@ class map : public RBTree<std::pair<Key, Value>, MapCompare<Key, Value>> {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using Compare = MapCompare<Key, Value>;
+  using Compare = MapCompare<Key, Value, KeyCompare>;
+  using key_compare = KeyCompare;
   using iterator = typename RBTree<std::pair<Key, Value>, Compare>::Iterator;
   using const_iterator =
       typename RBTree<std::pair<Key, Value>, Compare>::ConstIterator;
+  using node_type = typename RBTree<value_type, Compare>::Node;
 
   map() : RBTree<value_type, Compare>(){};
   map(const map &other) : RBTree<value_type, Compare>(other){};
@@ -39,29 +67,99 @@ class map : public RBTree<std::pair<Key, Value>, MapCompare<Key, Value>> {
       : RBTree<value_type, Compare>(items){};
   ~map() = default;
 
+  // пары упорядочены по ключу; из пар с равными ключами берется первая. O(n)
+  template <typename ForwardIt>
+  static map from_sorted(ForwardIt first, ForwardIt last) {
+    map result;
+    result.AssignSorted(first, last, true);
+    return result;
+  }
+
   map &operator=(map &&other) noexcept = default;
 
+  using RBTree<value_type, Compare>::find;
+
+  // поиск и доступ по ключу идут без временной пары
+  iterator find(const key_type &key) {
+    node_type *node = this->FindNode(this->head_, key);
+    return node == nullptr ? this->end() : iterator(node, this);
+  }
+
   mapped_type &at(const Key &key) {
-    value_type temp_pair{key, mapped_type{}};
-    iterator it = this->find(temp_pair);
-    if (it == this->end()) {
+    node_type *node = this->FindNode(this->head_, key);
+    if (node == nullptr) {
       throw std::out_of_range("No such element exists");
     }
-    return (*it).second;
+    return node->key_.second;
   }
 
-  mapped_type &operator[](const key_type &key) {
-    value_type temp_pair{key, mapped_type{}};
-    if (!this->Contains(temp_pair)) {
-      this->insert(temp_pair);
+  const mapped_type &at(const Key &key) const {
+    node_type *node = this->FindNode(this->head_, key);
+    if (node == nullptr) {
+      throw std::out_of_range("No such element exists");
     }
-    iterator it = this->find(temp_pair);
-    return (*it).second;
+    return node->key_.second;
   }
 
-  bool contains(const Key &key) {
-    value_type temp_pair{key, mapped_type{}};
-    return this->Contains(temp_pair);
+  // один спуск: значение по умолчанию строится, только если ключа нет
+  mapped_type &operator[](const key_type &key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  bool contains(const Key &key) const { return this->Contains(key); }
+
+  size_type count(const Key &key) const { return this->Contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) { return this->LowerBound(key); }
+
+  iterator upper_bound(const key_type &key) { return this->UpperBound(key); }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::pair<iterator, iterator>(this->LowerBound(key),
+                                         this->UpperBound(key));
+  }
+
+  // поиск по любому типу, сравнимому с Key, если KeyCompare прозрачный
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator find(const K &key) {
+    node_type *node = this->FindNode(this->head_, key);
+    return node == nullptr ? this->end() : iterator(node, this);
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  bool contains(const K &key) const {
+    return this->Contains(key);
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  size_type count(const K &key) const {
+    return this->Contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator lower_bound(const K &key) {
+    return this->LowerBound(key);
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  iterator upper_bound(const K &key) {
+    return this->UpperBound(key);
+  }
+
+  template <typename K, typename C = KeyCompare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return std::pair<iterator, iterator>(this->LowerBound(key),
+                                         this->UpperBound(key));
   }
 
   std::pair<iterator, bool> insert(const value_type &value) {
@@ -69,18 +167,61 @@ class map : public RBTree<std::pair<Key, Value>, MapCompare<Key, Value>> {
   }
 
   std::pair<iterator, bool> insert(const Key &k, mapped_type &&obj) {
-    return this->InsertUnique(value_type{k, obj});
+    return try_emplace(k, std::move(obj));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return this->EmplaceUnique(std::forward<Args>(args)...);
+  }
+
+  // вставка рядом с hint без спуска от корня, если ключ ложится прямо
+  // перед hint или после него (см. set::insert)
+  iterator insert(iterator hint, const value_type &value) {
+    return this->TryEmplaceHint(hint, value, value);
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return this->EmplaceHint(hint, true, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  iterator try_emplace(iterator hint, const key_type &key, Args &&...args) {
+    return this->TryEmplaceHint(
+        hint, key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  // значение строится из args, только если ключа key еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return this->TryEmplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return this->TryEmplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
   }
 
   std::pair<iterator, bool> insert_or_assign(const Key &key, const Value &obj) {
-    value_type temp_pair{key, obj};
-    iterator it = this->find(temp_pair);
-    if (it == this->end()) {
-      return this->insert(temp_pair);
-    } else {
-      (*it).second = std::move(obj);
-      return {it, false};
+    std::pair<iterator, bool> result = try_emplace(key, obj);
+    if (!result.second) {
+      (*result.first).second = obj;
+    }
+    return result;
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, Value &&obj) {
+    std::pair<iterator, bool> result = try_emplace(key, std::move(obj));
+    if (!result.second) {
+      (*result.first).second = std::move(obj);
     }
+    return result;
   }
 
 };  // class map
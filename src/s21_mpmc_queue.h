@@ -0,0 +1,184 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_concurrency/s21_sync.h"
+
+namespace s21 {
+
+// Ограниченная очередь без блокировок для многих производителей и многих
+// потребителей (схема Д. Вьюкова). У каждой ячейки есть счетчик sequence:
+// sequence == pos -- ячейка свободна для записи с номером pos,
+// sequence == pos + 1 -- в ней лежит элемент для чтения с номером pos.
+// Производители и потребители соревнуются только за свой индекс через CAS
+// и никогда не ждут друг друга внутри try_push/try_pop.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // емкость округляется вверх до степени двойки
+  explicit mpmc_queue(size_type capacity)
+      : capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        cells_(new Cell[capacity_]) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &other) = delete;
+  mpmc_queue &operator=(const mpmc_queue &other) = delete;
+
+  ~mpmc_queue() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) {
+      cells_[head & mask_].Value()->~value_type();
+    }
+    delete[] cells_;
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  // после захвата ячейки ее sequence обязательно публикуется, поэтому
+  // бросающий конструктор не должен работать внутри нее: такой элемент
+  // сначала строится во временном объекте, а в ячейку только перемещается
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible<value_type,
+                                                Args &&...>::value) {
+      return TryEmplace(std::forward<Args>(args)...);
+    } else {
+      static_assert(std::is_nothrow_move_constructible<value_type>::value,
+                    "mpmc_queue requires a nothrow move constructor");
+      value_type value(std::forward<Args>(args)...);
+      return TryEmplace(std::move(value));
+    }
+  }
+
+  bool try_pop(reference value) {
+    size_type pos = head_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                           static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+    value_type *item = cell->Value();
+    try {
+      value = std::move(*item);
+    } catch (...) {
+      // ячейка все равно освобождается, иначе производители встанут на ней
+      // навсегда; сам элемент при этом теряется
+      item->~value_type();
+      cell->sequence.store(pos + capacity_, std::memory_order_release);
+      throw;
+    }
+    item->~value_type();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  // блокирующие варианты: пока очередь полна (пуста), поток сначала
+  // крутится, а затем уступает процессор
+  void push(const_reference value) {
+    Backoff backoff;
+    while (!try_push(value)) {
+      backoff.Pause();
+    }
+  }
+
+  void push(value_type &&value) {
+    Backoff backoff;
+    while (!try_push(std::move(value))) {
+      backoff.Pause();
+    }
+  }
+
+  void pop(reference value) {
+    Backoff backoff;
+    while (!try_pop(value)) {
+      backoff.Pause();
+    }
+  }
+
+  // из других потоков значения ниже -- лишь мгновенный снимок
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  const size_type capacity_;
+  const size_type mask_;
+  Cell *const cells_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+
+  // конструктор Args не бросает: это проверяет try_emplace
+  template <typename... Args>
+  bool TryEmplace(Args &&...args) noexcept {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                           static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) value_type(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+}  // namespace s21
+
+#endif
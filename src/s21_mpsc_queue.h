@@ -0,0 +1,110 @@
+#ifndef S21_MPSC_QUEUE_H
+#define S21_MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "s21_concurrency/s21_sync.h"
+
+namespace s21 {
+
+// Узел интрузивной очереди: элемент очереди наследуется от него
+struct mpsc_queue_hook {
+  std::atomic<mpsc_queue_hook *> next{nullptr};
+};
+
+// Интрузивная очередь без блокировок для многих производителей и одного
+// потребителя (схема Д. Вьюкова). Производитель делает ровно один atomic
+// exchange и не ждет ни других производителей, ни потребителя; потребитель
+// обходится без CAS. Очередь не владеет элементами и ничего не выделяет:
+// элемент должен оставаться живым, пока его не извлекут.
+//
+// Пока производитель находится между exchange и записью ссылки на свой узел,
+// узлы за ним потребителю не видны, и pop временно возвращает nullptr.
+template <typename T>
+class mpsc_queue {
+  static_assert(std::is_base_of<mpsc_queue_hook, T>::value,
+                "mpsc_queue elements must derive from mpsc_queue_hook");
+
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using size_type = size_t;
+
+  mpsc_queue() : head_(&stub_), tail_(&stub_) {}
+
+  mpsc_queue(const mpsc_queue &other) = delete;
+  mpsc_queue &operator=(const mpsc_queue &other) = delete;
+
+  // любой поток
+  void push(pointer item) noexcept { PushHook(item); }
+
+  // только потребитель; nullptr, если очередь пуста
+  pointer pop() noexcept {
+    mpsc_queue_hook *tail = tail_;
+    mpsc_queue_hook *next = tail->next.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+      if (next == nullptr) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<pointer>(tail);
+    }
+    if (tail != head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    // tail -- последний узел: чтобы его отдать, за ним нужен хоть один узел
+    PushHook(&stub_);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<pointer>(tail);
+    }
+    return nullptr;
+  }
+
+  // только потребитель: извлекает до max элементов и для каждого вызывает
+  // consume(pointer); возвращает их число
+  template <typename Consume>
+  size_type drain(Consume consume,
+                  size_type max = std::numeric_limits<size_type>::max()) {
+    size_type count = 0;
+    for (; count < max; ++count) {
+      pointer item = pop();
+      if (item == nullptr) {
+        break;
+      }
+      consume(item);
+    }
+    return count;
+  }
+
+  // только потребитель: true, если pop сейчас вернул бы nullptr
+  bool empty() const noexcept {
+    return tail_ == &stub_ &&
+           stub_.next.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  alignas(kCacheLineSize) std::atomic<mpsc_queue_hook *> head_;
+  alignas(kCacheLineSize) mpsc_queue_hook *tail_;
+  mpsc_queue_hook stub_;
+
+  void PushHook(mpsc_queue_hook *hook) noexcept {
+    hook->next.store(nullptr, std::memory_order_relaxed);
+    mpsc_queue_hook *previous =
+        head_.exchange(hook, std::memory_order_acq_rel);
+    previous->next.store(hook, std::memory_order_release);
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef S21_MULTICAST_RING_BUFFER_H
+#define S21_MULTICAST_RING_BUFFER_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+
+#include "s21_concurrency/s21_sync.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Кольцевой буфер в духе LMAX Disruptor для одного производителя и многих
+// потребителей. Ячейки выделяются один раз и переиспользуются: производитель
+// занимает (claim) номера ячеек, заполняет их на месте и публикует
+// (publish), а каждый потребитель читает те же ячейки по своему курсору --
+// событие не копируется ни в одну очередь. Потребитель может зависеть от
+// других потребителей: он видит событие только после того, как его
+// отпустили все зависимости, -- так строятся конвейеры из нескольких стадий.
+// Производитель не обгоняет на круг потребителей, от которых никто не
+// зависит (последние стадии).
+//
+// Номера событий -- сквозные 64-битные последовательности, начиная с 0.
+// Потребители добавляются до запуска потоков.
+template <typename T>
+class multicast_ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using sequence_type = std::int64_t;
+  using consumer_type = size_t;
+
+  // емкость округляется вверх до степени двойки
+  explicit multicast_ring_buffer(size_type capacity)
+      : capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        slots_(new value_type[capacity_]()) {}
+
+  multicast_ring_buffer(const multicast_ring_buffer &other) = delete;
+  multicast_ring_buffer &operator=(const multicast_ring_buffer &other) =
+      delete;
+
+  // потребитель видит событие, когда оно опубликовано и отпущено всеми
+  // dependencies
+  consumer_type add_consumer(
+      std::initializer_list<consumer_type> dependencies = {}) {
+    std::unique_ptr<Consumer> consumer(new Consumer());
+    for (consumer_type dependency : dependencies) {
+      if (dependency >= consumers_.size()) {
+        throw std::out_of_range("\n unknown consumer\n");
+      }
+      consumer->dependencies.push_back(dependency);
+      consumers_[dependency]->gating = false;
+    }
+    consumers_.push_back(std::move(consumer));
+    return consumers_.size() - 1;
+  }
+
+  size_type consumers() const noexcept { return consumers_.size(); }
+  size_type capacity() const noexcept { return capacity_; }
+
+  // производитель: занимает count следующих ячеек и возвращает номер
+  // первой; ждет, пока последние стадии освободят место
+  sequence_type claim(size_type count = 1) {
+    assert(count != 0 && count <= capacity_);
+    Backoff backoff;
+    while (!HasRoom(count)) {
+      backoff.Pause();
+    }
+    return Claimed(count);
+  }
+
+  bool try_claim(size_type count, sequence_type &first) {
+    assert(count != 0 && count <= capacity_);
+    if (!HasRoom(count)) {
+      return false;
+    }
+    first = Claimed(count);
+    return true;
+  }
+
+  // производитель: делает видимыми все занятые ячейки до last включительно
+  void publish(sequence_type last) noexcept {
+    assert(last < next_);
+    cursor_.store(last, std::memory_order_release);
+  }
+
+  reference operator[](sequence_type sequence) noexcept {
+    return slots_[static_cast<size_type>(sequence) & mask_];
+  }
+  const_reference operator[](sequence_type sequence) const noexcept {
+    return slots_[static_cast<size_type>(sequence) & mask_];
+  }
+
+  // последний опубликованный номер; -1, пока ничего не опубликовано
+  sequence_type cursor() const noexcept {
+    return cursor_.load(std::memory_order_acquire);
+  }
+
+  // потребитель: наибольший номер, доступный ему прямо сейчас
+  sequence_type try_available(consumer_type consumer) const noexcept {
+    const Consumer &self = *consumers_[consumer];
+    sequence_type available = cursor_.load(std::memory_order_acquire);
+    for (size_type i = 0; i < self.dependencies.size(); ++i) {
+      sequence_type released =
+          consumers_[self.dependencies[i]]->sequence.load(
+              std::memory_order_acquire);
+      if (released < available) {
+        available = released;
+      }
+    }
+    return available;
+  }
+
+  // потребитель: ждет, пока станет доступен номер next, и возвращает
+  // наибольший доступный -- все события [next, результат] можно
+  // обработать одной пачкой
+  sequence_type wait_for(consumer_type consumer, sequence_type next) const {
+    Backoff backoff;
+    sequence_type available = try_available(consumer);
+    while (available < next) {
+      backoff.Pause();
+      available = try_available(consumer);
+    }
+    return available;
+  }
+
+  // потребитель: события до sequence включительно обработаны
+  void release(consumer_type consumer, sequence_type sequence) noexcept {
+    consumers_[consumer]->sequence.store(sequence, std::memory_order_release);
+  }
+
+ private:
+  struct alignas(kCacheLineSize) Consumer {
+    std::atomic<sequence_type> sequence{-1};
+    s21::vector<consumer_type> dependencies;
+    // от потребителя никто не зависит: его ждет производитель
+    bool gating = true;
+  };
+
+  const size_type capacity_;
+  const size_type mask_;
+  std::unique_ptr<value_type[]> slots_;
+  s21::vector<std::unique_ptr<Consumer>> consumers_;
+
+  alignas(kCacheLineSize) std::atomic<sequence_type> cursor_{-1};
+  // поля ниже трогает только производитель
+  alignas(kCacheLineSize) sequence_type next_ = 0;
+  sequence_type cached_gate_ = -1;
+
+  sequence_type SlowestGate() const noexcept {
+    sequence_type slowest = next_ - 1;
+    for (size_type i = 0; i < consumers_.size(); ++i) {
+      if (!consumers_[i]->gating) continue;
+      sequence_type released =
+          consumers_[i]->sequence.load(std::memory_order_acquire);
+      if (released < slowest) {
+        slowest = released;
+      }
+    }
+    return slowest;
+  }
+
+  bool HasRoom(size_type count) noexcept {
+    sequence_type wrap_point =
+        next_ + static_cast<sequence_type>(count) - 1 -
+        static_cast<sequence_type>(capacity_);
+    if (wrap_point <= cached_gate_) {
+      return true;
+    }
+    cached_gate_ = SlowestGate();
+    return wrap_point <= cached_gate_;
+  }
+
+  sequence_type Claimed(size_type count) noexcept {
+    sequence_type first = next_;
+    next_ += static_cast<sequence_type>(count);
+    return first;
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -1,81 +1,96 @@
 #ifndef SRC_21_MULTISET_H
 #define SRC_21_MULTISET_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <type_traits>
 #include <utility>
 
 #include "s21_binary_tree/s21_tree.h"
 
 namespace s21 {
 
-template <typename Key>
-class multiset : public RBTree<Key> {
+template <typename Key, typename Compare = std::less<Key>>
+class multiset : public RBTree<Key, Compare> {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename RBTree<Key>::iterator;
-  using const_iterator = typename RBTree<Key>::const_iterator;
+  using iterator = typename RBTree<Key, Compare>::iterator;
+  using const_iterator = typename RBTree<Key, Compare>::const_iterator;
   using size_type = size_t;
+  using key_compare = Compare;
 
-  multiset() : RBTree<Key>(){};
-  multiset(const multiset& other) : RBTree<Key>(other){};
-  multiset(multiset&& other) : RBTree<Key>(std::move(other)){};
+  multiset() : RBTree<Key, Compare>(){};
+  multiset(const multiset& other) : RBTree<Key, Compare>(other){};
+  multiset(multiset&& other) : RBTree<Key, Compare>(std::move(other)){};
   multiset& operator=(multiset&& other) noexcept = default;
 
   multiset(std::initializer_list<value_type> const& items) : multiset() {
-    for (const auto& item : items) {
-      this->InsertNotUnique(item);
+    if (this->IsSorted(items.begin(), items.end())) {
+      this->AssignSorted(items.begin(), items.end(), false);
+    } else {
+      for (const auto& item : items) {
+        this->InsertNotUnique(item);
+      }
     }
   }
 
   ~multiset() = default;
 
+  // [first, last) упорядочен по Compare. O(n)
+  template <typename ForwardIt>
+  static multiset from_sorted(ForwardIt first, ForwardIt last) {
+    multiset result;
+    result.AssignSorted(first, last, false);
+    return result;
+  }
+
   iterator insert(const value_type& value) {
     return this->InsertNotUnique(value);
   }
 
-  void merge(multiset& other) { this->MergeMultiset(other); }
-
-  bool contains(const Key& key) const noexcept { return this->Contains(key); }
+  template <typename... Args>
+  iterator emplace(Args&&... args) {
+    return this->EmplaceNotUnique(std::forward<Args>(args)...);
+  }
 
-  iterator lower_bound(const Key& key) noexcept {
-    iterator start = this->begin();
-    iterator end = this->end();
-    if (this->size() == 0) return end;
-    for (; start != end && *start != key; start++)
-      ;
-    return start;
+  // вставка прямо перед hint, если порядок это допускает, иначе обычная
+  iterator insert(iterator hint, const value_type& value) {
+    return this->EmplaceHint(hint, false, value);
   }
 
-  iterator upper_bound(const Key& key) noexcept {
-    iterator start = lower_bound(key);
-    iterator end = this->end();
-    if (this->size() == 0) return end;
-    for (; start != end && *start == key; ++start)
-      ;
-    return start;
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    return this->EmplaceHint(hint, false, std::forward<Args>(args)...);
   }
 
-  std::pair<iterator, iterator> equal_range(const Key& key) noexcept {
-    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+  void merge(multiset& other) { this->MergeMultiset(other); }
+
+  bool contains(const Key& key) const noexcept { return this->Contains(key); }
+
+  // поиск по любому типу, сравнимому с Key, если компаратор прозрачный
+  template <typename K, typename C = Compare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  bool contains(const K& key) const {
+    return this->Contains(key);
   }
 
-  size_type count(const Key& key) noexcept {
-    iterator lower_bound = this->lower_bound(key);
-    size_type counter = 0;
-    iterator end = this->end();
-    for (; lower_bound != end && *lower_bound == key; ++lower_bound) ++counter;
-    return counter;
+  size_type count(const Key& key) { return this->CountEqual(key); }
+
+  template <typename K, typename C = Compare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  size_type count(const K& key) {
+    return this->CountEqual(key);
   }
 
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     s21::vector<std::pair<iterator, bool>> results;
     (results.insert_many_back(
-         s21::RBTree<int>::InsertManyNotUnique(std::forward<Args>(args))),
+         this->InsertManyNotUnique(std::forward<Args>(args))),
      ...);
     return results;
   }
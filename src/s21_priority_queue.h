@@ -0,0 +1,266 @@
+#ifndef S21_PRIORITY_QUEUE_H
+#define S21_PRIORITY_QUEUE_H
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Операции над d-ичной кучей в s21::vector. У узла pos дети лежат подряд в
+// [pos * Arity + 1, pos * Arity + Arity], поэтому при Arity = 4 все дети
+// обычно попадают в одну кэш-линию, а высота кучи вдвое меньше, чем у
+// двоичной. Элементы сдвигаются в "дырку", а не переставляются попарно.
+// OnMove(pos) вызывается каждый раз, когда в heap[pos] кладется новый
+// элемент -- через него индексированная куча следит за позициями.
+template <size_t Arity>
+struct DaryHeap {
+  static_assert(Arity >= 2, "heap arity must be at least 2");
+
+  template <typename Heap, typename Less, typename OnMove>
+  static void SiftUp(Heap &heap, size_t pos, Less less, OnMove on_move) {
+    auto value = std::move(heap[pos]);
+    while (pos > 0) {
+      size_t parent = (pos - 1) / Arity;
+      if (!less(heap[parent], value)) break;
+      heap[pos] = std::move(heap[parent]);
+      on_move(pos);
+      pos = parent;
+    }
+    heap[pos] = std::move(value);
+    on_move(pos);
+  }
+
+  template <typename Heap, typename Less, typename OnMove>
+  static void SiftDown(Heap &heap, size_t pos, Less less, OnMove on_move) {
+    size_t size = heap.size();
+    auto value = std::move(heap[pos]);
+    for (;;) {
+      size_t first_child = pos * Arity + 1;
+      if (first_child >= size) break;
+      size_t last_child =
+          first_child + Arity < size ? first_child + Arity : size;
+      size_t best = first_child;
+      for (size_t child = first_child + 1; child < last_child; ++child) {
+        if (less(heap[best], heap[child])) best = child;
+      }
+      if (!less(value, heap[best])) break;
+      heap[pos] = std::move(heap[best]);
+      on_move(pos);
+      pos = best;
+    }
+    heap[pos] = std::move(value);
+    on_move(pos);
+  }
+
+  // построение кучи снизу вверх за O(n)
+  template <typename Heap, typename Less, typename OnMove>
+  static void Heapify(Heap &heap, Less less, OnMove on_move) {
+    size_t size = heap.size();
+    if (size < 2) return;
+    for (size_t pos = (size - 2) / Arity + 1; pos-- > 0;) {
+      SiftDown(heap, pos, less, on_move);
+    }
+  }
+};
+
+// Как и std::priority_queue, при Compare = std::less наверху лежит
+// наибольший элемент
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+ public:
+  using container_type = s21::vector<T>;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  priority_queue() : data_(), compare_() {}
+
+  explicit priority_queue(const Compare &compare)
+      : data_(), compare_(compare) {}
+
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const Compare &compare = Compare())
+      : data_(), compare_(compare) {
+    for (; first != last; ++first) {
+      data_.push_back(*first);
+    }
+    Heap::Heapify(data_, compare_, NoTracking);
+  }
+
+  priority_queue(std::initializer_list<value_type> const &items)
+      : priority_queue(items.begin(), items.end()) {}
+
+  const_reference top() const {
+    assert(!data_.empty());
+    return data_[0];
+  }
+
+  bool empty() const { return data_.empty(); }
+  size_type size() const { return data_.size(); }
+
+  void push(const_reference value) {
+    data_.push_back(value);
+    Heap::SiftUp(data_, data_.size() - 1, compare_, NoTracking);
+  }
+
+  void pop() {
+    assert(!data_.empty());
+    size_type last = data_.size() - 1;
+    if (last != 0) {
+      data_[0] = std::move(data_[last]);
+    }
+    data_.pop_back();
+    if (!data_.empty()) {
+      Heap::SiftDown(data_, 0, compare_, NoTracking);
+    }
+  }
+
+  void swap(priority_queue &other) {
+    data_.swap(other.data_);
+    std::swap(compare_, other.compare_);
+  }
+
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  using Heap = DaryHeap<Arity>;
+
+  container_type data_;
+  Compare compare_;
+
+  static void NoTracking(size_t) noexcept {}
+};
+
+// Куча с постоянными дескрипторами: push возвращает handle, по которому
+// элемент можно найти, изменить (decrease_key / update) или удалить из
+// середины кучи за O(log n). Дескрипторы удаленных элементов переиспользуются.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class indexed_priority_queue {
+ public:
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using handle_type = size_t;
+
+  indexed_priority_queue() : compare_() {}
+
+  explicit indexed_priority_queue(const Compare &compare) : compare_(compare) {}
+
+  const_reference top() const {
+    assert(!heap_.empty());
+    return values_[heap_[0]];
+  }
+
+  handle_type top_handle() const {
+    assert(!heap_.empty());
+    return heap_[0];
+  }
+
+  bool empty() const { return heap_.empty(); }
+  size_type size() const { return heap_.size(); }
+
+  bool contains(handle_type handle) const {
+    return handle < position_.size() && position_[handle] != kNotInHeap;
+  }
+
+  const_reference value(handle_type handle) const {
+    assert(contains(handle));
+    return values_[handle];
+  }
+
+  handle_type push(const_reference value) {
+    handle_type handle;
+    if (!free_handles_.empty()) {
+      handle = free_handles_.back();
+      free_handles_.pop_back();
+      values_[handle] = value;
+    } else {
+      handle = values_.size();
+      values_.push_back(value);
+      position_.push_back(kNotInHeap);
+    }
+    heap_.push_back(handle);
+    Heap::SiftUp(heap_, heap_.size() - 1, HandleLess(), Tracking());
+    return handle;
+  }
+
+  void pop() { erase(top_handle()); }
+
+  // новое значение должно быть не "хуже" старого по Compare: элемент может
+  // только подняться к вершине
+  void decrease_key(handle_type handle, const_reference value) {
+    assert(contains(handle));
+    assert(!compare_(value, values_[handle]));
+    values_[handle] = value;
+    Heap::SiftUp(heap_, position_[handle], HandleLess(), Tracking());
+  }
+
+  // произвольное изменение значения
+  void update(handle_type handle, const_reference value) {
+    assert(contains(handle));
+    bool goes_up = compare_(values_[handle], value);
+    values_[handle] = value;
+    if (goes_up) {
+      Heap::SiftUp(heap_, position_[handle], HandleLess(), Tracking());
+    } else {
+      Heap::SiftDown(heap_, position_[handle], HandleLess(), Tracking());
+    }
+  }
+
+  void erase(handle_type handle) {
+    assert(contains(handle));
+    size_type pos = position_[handle];
+    size_type last = heap_.size() - 1;
+    position_[handle] = kNotInHeap;
+    free_handles_.push_back(handle);
+    if (pos != last) {
+      handle_type moved = heap_[last];
+      heap_[pos] = moved;
+      position_[moved] = pos;
+      heap_.pop_back();
+      Heap::SiftUp(heap_, pos, HandleLess(), Tracking());
+      Heap::SiftDown(heap_, position_[moved], HandleLess(), Tracking());
+    } else {
+      heap_.pop_back();
+    }
+  }
+
+ private:
+  using Heap = DaryHeap<Arity>;
+
+  static constexpr size_type kNotInHeap = std::numeric_limits<size_type>::max();
+
+  s21::vector<value_type> values_;
+  s21::vector<size_type> position_;
+  s21::vector<handle_type> heap_;
+  s21::vector<handle_type> free_handles_;
+  Compare compare_;
+
+  auto HandleLess() const {
+    return [this](handle_type left, handle_type right) {
+      return compare_(values_[left], values_[right]);
+    };
+  }
+
+  auto Tracking() {
+    return [this](size_t pos) { position_[heap_[pos]] = pos; };
+  }
+};
+
+}  // namespace s21
+
+#endif
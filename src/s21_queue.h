@@ -1,45 +1,79 @@
 #ifndef S21_QUEUE_H
 #define S21_QUEUE_H
 
+#include <cassert>
 #include <initializer_list>
 #include <iostream>
 
-#include "s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
 
-template <typename T>
+// Container -- любой контейнер с push_back, pop_front, front и back:
+// s21::ring_buffer (по умолчанию), s21::deque или s21::list
+template <typename T, typename Container = s21::ring_buffer<T>>
 class queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
 
-  queue() : l() {}
+  queue() : container_() {}
 
-  queue(std::initializer_list<value_type> const &items) : l(items) {}
+  queue(std::initializer_list<value_type> const &items) : container_(items) {}
 
-  queue(const queue &q) : l(q.l) {}
+  queue(const queue &q) : container_(q.container_) {}
 
-  queue(queue &&q) : l(std::move(q.l)) {}
+  queue(queue &&q) : container_(std::move(q.container_)) {}
 
-  ~queue() { this->l.clear(); }
+  ~queue() { this->container_.clear(); }
 
   queue &operator=(queue &&q) {
-    this->l = std::move(q.l);
-    return this;
+    this->container_ = std::move(q.container_);
+    return *this;
   }
 
-  const_reference front() { return this->l.front(); }
-  const_reference back() { return this->l.back(); }
+  reference front() { return this->container_.front(); }
+  reference back() { return this->container_.back(); }
 
-  bool empty() { return this->l.empty(); }
-  size_type size() { return this->l.size(); }
+  bool empty() { return this->container_.empty(); }
+  size_type size() { return this->container_.size(); }
 
-  void push(const_reference value) { this->l.push_back(value); }
-  void pop() { this->l.pop_front(); }
-  void swap(queue &other) { this->l.swap(other.l); }
+  void push(const_reference value) { this->container_.push_back(value); }
+  void push(value_type &&value) {
+    this->container_.push_back(std::move(value));
+  }
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return this->container_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop() { this->container_.pop_front(); }
+
+  // извлекает первый элемент перемещением
+  value_type pop_value() {
+    assert(!this->container_.empty());
+    value_type value = std::move(this->container_.front());
+    this->container_.pop_front();
+    return value;
+  }
+
+  bool try_pop(reference value) {
+    if (this->container_.empty()) {
+      return false;
+    }
+    value = std::move(this->container_.front());
+    this->container_.pop_front();
+    return true;
+  }
+
+  void swap(queue &other) { this->container_.swap(other.container_); }
+
+  void reserve(size_type size) { this->container_.reserve(size); }
+  void shrink_to_fit() { this->container_.shrink_to_fit(); }
 
   template <typename... Args>
   void insert_many_back(Args &&...args) {
@@ -47,9 +81,9 @@ class queue {
   }
 
  private:
-  s21::list<value_type> l;
+  container_type container_;
 };
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
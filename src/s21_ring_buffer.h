@@ -0,0 +1,287 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Кольцевой буфер с емкостью, равной степени двойки: позиция элемента
+// вычисляется маской, а не делением. При росте элементы переносятся в новый
+// буфер уже "развернутыми" -- начиная с нулевой ячейки.
+template <typename T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  ring_buffer() = default;
+
+  explicit ring_buffer(size_type capacity) { reserve(capacity); }
+
+  ring_buffer(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const auto &item : items) {
+      push_back(item);
+    }
+  }
+
+  ring_buffer(const ring_buffer &other) {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(other[i]);
+    }
+  }
+
+  ring_buffer(ring_buffer &&other) noexcept { swap(other); }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    if (this != &other) {
+      ring_buffer empty;
+      swap(empty);
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~ring_buffer() {
+    clear();
+    Deallocate(data_);
+  }
+
+  reference operator[](size_type pos) { return data_[Slot(pos)]; }
+  const_reference operator[](size_type pos) const { return data_[Slot(pos)]; }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("\n index out of range\n");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() {
+    assert(size_ != 0);
+    return data_[head_];
+  }
+  const_reference front() const {
+    assert(size_ != 0);
+    return data_[head_];
+  }
+
+  reference back() {
+    assert(size_ != 0);
+    return data_[Slot(size_ - 1)];
+  }
+  const_reference back() const {
+    assert(size_ != 0);
+    return data_[Slot(size_ - 1)];
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  // емкость округляется вверх до степени двойки
+  void reserve(size_type size) {
+    if (size <= capacity_) return;
+    if (size > max_size()) {
+      throw std::length_error("\n bigger then max size\n");
+    }
+    Reallocate(RoundUp(size));
+  }
+
+  void shrink_to_fit() {
+    size_type fitted = size_ == 0 ? 0 : RoundUp(size_);
+    if (fitted < capacity_) {
+      Reallocate(fitted);
+    }
+  }
+
+  void clear() noexcept {
+    while (size_ != 0) {
+      pop_back();
+    }
+    head_ = 0;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // при нехватке места новый элемент строится в новом буфере раньше, чем
+  // туда переносятся старые, поэтому аргумент может ссылаться на элемент
+  // самого буфера
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    size_type slot = size_ == capacity_
+                         ? GrowAndEmplace(size_, std::forward<Args>(args)...)
+                         : Emplace(Slot(size_), std::forward<Args>(args)...);
+    ++size_;
+    return data_[slot];
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  // в новом буфере элемент кладется в последнюю ячейку: старые элементы
+  // переезжают в начало, и голова оказывается сразу перед ними по кругу
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    size_type slot =
+        size_ == capacity_
+            ? GrowAndEmplace(NextCapacity() - 1, std::forward<Args>(args)...)
+            : Emplace((head_ + capacity_ - 1) & (capacity_ - 1),
+                      std::forward<Args>(args)...);
+    head_ = slot;
+    ++size_;
+    return data_[slot];
+  }
+
+  void pop_front() {
+    if (size_ != 0) {
+      data_[head_].~value_type();
+      head_ = (head_ + 1) & (capacity_ - 1);
+      --size_;
+    }
+  }
+
+  void pop_back() {
+    if (size_ != 0) {
+      data_[Slot(size_ - 1)].~value_type();
+      --size_;
+    }
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    reserve(size_ + sizeof...(args));
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  value_type *data_ = nullptr;
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type size_ = 0;
+
+  size_type Slot(size_type pos) const noexcept {
+    return (head_ + pos) & (capacity_ - 1);
+  }
+
+  static size_type RoundUp(size_type size) noexcept {
+    size_type capacity = kMinCapacity;
+    while (capacity < size) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  size_type NextCapacity() const noexcept {
+    return capacity_ == 0 ? kMinCapacity : capacity_ * 2;
+  }
+
+  template <typename... Args>
+  size_type Emplace(size_type slot, Args &&...args) {
+    new (data_ + slot) value_type(std::forward<Args>(args)...);
+    return slot;
+  }
+
+  // строит элемент в ячейке slot нового буфера и только потом переносит туда
+  // старые элементы; голова нового буфера -- нулевая ячейка
+  template <typename... Args>
+  size_type GrowAndEmplace(size_type slot, Args &&...args) {
+    size_type capacity = NextCapacity();
+    value_type *new_data = Allocate(capacity);
+    try {
+      new (new_data + slot) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      Deallocate(new_data);
+      throw;
+    }
+    try {
+      MoveTo(new_data);
+    } catch (...) {
+      new_data[slot].~value_type();
+      Deallocate(new_data);
+      throw;
+    }
+    Adopt(new_data, capacity);
+    return slot;
+  }
+
+  static value_type *Allocate(size_type capacity) {
+    if (capacity == 0) return nullptr;
+    return static_cast<value_type *>(
+        ::operator new(capacity * sizeof(value_type)));
+  }
+
+  static void Deallocate(value_type *data) noexcept { ::operator delete(data); }
+
+  // переносит элементы в начало new_data; при исключении уже перенесенные
+  // разрушаются, а сам new_data освобождает вызывающий
+  void MoveTo(value_type *new_data) {
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        new (new_data + moved)
+            value_type(std::move_if_noexcept((*this)[moved]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i) {
+        new_data[i].~value_type();
+      }
+      throw;
+    }
+  }
+
+  void Adopt(value_type *new_data, size_type capacity) noexcept {
+    for (size_type i = 0; i < size_; ++i) {
+      (*this)[i].~value_type();
+    }
+    Deallocate(data_);
+    data_ = new_data;
+    capacity_ = capacity;
+    head_ = 0;
+  }
+
+  void Reallocate(size_type capacity) {
+    value_type *new_data = Allocate(capacity);
+    try {
+      MoveTo(new_data);
+    } catch (...) {
+      Deallocate(new_data);
+      throw;
+    }
+    Adopt(new_data, capacity);
+  }
+};
+
+}  // namespace s21
+
+#endif
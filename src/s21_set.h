@@ -1,8 +1,10 @@
 #ifndef SRC_21_SET_H
 #define SRC_21_SET_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -10,36 +12,137 @@
 
 namespace s21 {
 
-template <typename Key>
-class set : public RBTree<Key> {
+template <typename Key, typename Compare = std::less<Key>>
+class set : public RBTree<Key, Compare> {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RBTree<value_type>::Iterator;
-  using node = typename RBTree<value_type>::Node;
-  using const_iterator = typename RBTree<value_type>::ConstIterator;
+  using iterator = typename RBTree<value_type, Compare>::Iterator;
+  using node = typename RBTree<value_type, Compare>::Node;
+  using const_iterator =
+      typename RBTree<value_type, Compare>::ConstIterator;
   using size_type = size_t;
-  using Comparator = std::less<Key>;
+  using Comparator = Compare;
+  using key_compare = Compare;
 
  public:
-  set() : RBTree<Key>(){};
-  set(const set &other) : RBTree<Key>(other){};
-  set(set &&other) : RBTree<Key>(std::move(other)){};
-  set(std::initializer_list<value_type> const &items) : RBTree<Key>(items){};
+  set() : RBTree<Key, Compare>(){};
+  set(const set &other) : RBTree<Key, Compare>(other){};
+  set(set &&other) : RBTree<Key, Compare>(std::move(other)){};
+  set(std::initializer_list<value_type> const &items)
+      : RBTree<Key, Compare>(items){};
 
   ~set() = default;
 
+  // [first, last) упорядочен по Compare; дубликаты отбрасываются. O(n)
+  template <typename ForwardIt>
+  static set from_sorted(ForwardIt first, ForwardIt last) {
+    set result;
+    result.AssignSorted(first, last, true);
+    return result;
+  }
+
   set &operator=(set &&other) noexcept = default;
 
   std::pair<iterator, bool> insert(const value_type &value) {
     return this->InsertUnique(value);
   }
 
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return this->TryEmplace(value, std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return this->EmplaceUnique(std::forward<Args>(args)...);
+  }
+
+  // вставка рядом с hint без спуска от корня, если ключ ложится прямо
+  // перед hint или после него: при вставке по возрастанию с hint == end()
+  // или с итератором на последний вставленный элемент -- O(1) амортизированно
+  iterator insert(iterator hint, const value_type &value) {
+    return this->TryEmplaceHint(hint, value, value);
+  }
+
+  iterator insert(iterator hint, value_type &&value) {
+    return this->TryEmplaceHint(hint, value, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return this->EmplaceHint(hint, true, std::forward<Args>(args)...);
+  }
+
   bool contains(const Key &key) const noexcept { return this->Contains(key); }
 
+  size_type count(const Key &key) const noexcept {
+    return this->Contains(key) ? 1 : 0;
+  }
+
+  // поиск по любому типу, сравнимому с Key, если компаратор прозрачный
+  template <typename K, typename C = Compare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  bool contains(const K &key) const {
+    return this->Contains(key);
+  }
+
+  template <typename K, typename C = Compare,
+            typename = std::enable_if_t<IsTransparent<C>::value>>
+  size_type count(const K &key) const {
+    return this->Contains(key) ? 1 : 0;
+  }
+
+ private:
+  using Operation = typename RBTree<Key, Compare>::SetOperation;
+
+  static set Combine(const set &a, const set &b, Operation operation) {
+    set result;
+    result.AssignSetOperation(a, b, operation);
+    return result;
+  }
+
+  template <typename K, typename C>
+  friend set<K, C> set_union(const set<K, C> &a, const set<K, C> &b);
+  template <typename K, typename C>
+  friend set<K, C> set_intersection(const set<K, C> &a, const set<K, C> &b);
+  template <typename K, typename C>
+  friend set<K, C> set_difference(const set<K, C> &a, const set<K, C> &b);
+  template <typename K, typename C>
+  friend set<K, C> set_symmetric_difference(const set<K, C> &a,
+                                            const set<K, C> &b);
 };  // class set
+
+// операции над множествами за O(n + m): оба дерева обходятся по порядку,
+// результат строится без поворотов
+
+template <typename Key, typename Compare>
+set<Key, Compare> set_union(const set<Key, Compare> &a,
+                            const set<Key, Compare> &b) {
+  return set<Key, Compare>::Combine(a, b, set<Key, Compare>::Union);
+}
+
+template <typename Key, typename Compare>
+set<Key, Compare> set_intersection(const set<Key, Compare> &a,
+                                   const set<Key, Compare> &b) {
+  return set<Key, Compare>::Combine(a, b, set<Key, Compare>::Intersection);
+}
+
+// элементы a, которых нет в b
+template <typename Key, typename Compare>
+set<Key, Compare> set_difference(const set<Key, Compare> &a,
+                                 const set<Key, Compare> &b) {
+  return set<Key, Compare>::Combine(a, b, set<Key, Compare>::Difference);
+}
+
+template <typename Key, typename Compare>
+set<Key, Compare> set_symmetric_difference(const set<Key, Compare> &a,
+                                           const set<Key, Compare> &b) {
+  return set<Key, Compare>::Combine(a, b,
+                                    set<Key, Compare>::SymmetricDifference);
+}
+
 }  // namespace s21
 
 #endif  // SRC_21_SET_H
\ No newline at end of file
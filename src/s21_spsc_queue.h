@@ -0,0 +1,170 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "s21_concurrency/s21_sync.h"
+
+namespace s21 {
+
+// Ограниченная очередь без блокировок для ровно одного производителя и
+// одного потребителя. Все операции wait-free: try_push/try_pop либо
+// выполняются за конечное число шагов, либо сразу возвращают false.
+//
+// Индексы head_ и tail_ только растут, ячейка вычисляется маской. Каждая
+// сторона хранит копию индекса другой стороны и перечитывает настоящий
+// атомарный индекс только когда по копии очередь выглядит полной (пустой).
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // емкость округляется вверх до степени двойки
+  explicit spsc_queue(size_type capacity)
+      : capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        data_(static_cast<value_type *>(
+            ::operator new(capacity_ * sizeof(value_type)))) {}
+
+  spsc_queue(const spsc_queue &other) = delete;
+  spsc_queue &operator=(const spsc_queue &other) = delete;
+
+  ~spsc_queue() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; ++head) {
+      data_[head & mask_].~value_type();
+    }
+    ::operator delete(data_);
+  }
+
+  // вызывается только производителем
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == capacity_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == capacity_) {
+        return false;
+      }
+    }
+    new (data_ + (tail & mask_)) value_type(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // кладет до count элементов, начиная с first, и публикует их одной
+  // записью tail_; возвращает, сколько элементов поместилось. Если
+  // конструктор бросит, уже построенные элементы пачки разрушаются и
+  // очередь остается прежней
+  template <typename InputIt>
+  size_type try_push_n(InputIt first, size_type count) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (capacity_ - (tail - cached_head_) < count) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+    }
+    size_type free_slots = capacity_ - (tail - cached_head_);
+    if (count > free_slots) {
+      count = free_slots;
+    }
+    size_type built = 0;
+    try {
+      for (; built < count; ++built, ++first) {
+        new (data_ + ((tail + built) & mask_)) value_type(*first);
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        data_[(tail + i) & mask_].~value_type();
+      }
+      throw;
+    }
+    if (count != 0) {
+      tail_.store(tail + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  // вызывается только потребителем
+  bool try_pop(reference value) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return false;
+      }
+    }
+    value_type *slot = data_ + (head & mask_);
+    value = std::move(*slot);
+    slot->~value_type();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // перемещает в out до max элементов и освобождает их ячейки одной
+  // записью head_; возвращает число извлеченных элементов. Если
+  // присваивание бросит, извлеченными считаются элементы до сбойного
+  template <typename OutputIt>
+  size_type try_pop_n(OutputIt out, size_type max) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ - head < max) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+    }
+    size_type count = cached_tail_ - head;
+    if (count > max) {
+      count = max;
+    }
+    size_type taken = 0;
+    try {
+      for (; taken < count; ++taken, ++out) {
+        value_type *slot = data_ + ((head + taken) & mask_);
+        *out = std::move(*slot);
+        slot->~value_type();
+      }
+    } catch (...) {
+      // уже разрушенные ячейки отдаются производителю, иначе их разрушат
+      // второй раз
+      head_.store(head + taken, std::memory_order_release);
+      throw;
+    }
+    if (count != 0) {
+      head_.store(head + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  // из других потоков значения ниже -- лишь мгновенный снимок
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  const size_type capacity_;
+  const size_type mask_;
+  value_type *const data_;
+
+  // кэш-линия потребителя
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  size_type cached_tail_ = 0;
+
+  // кэш-линия производителя
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  size_type cached_head_ = 0;
+};
+
+}  // namespace s21
+
+#endif
@@ -1,48 +1,96 @@
 #ifndef S21_STACK_H
 #define S21_STACK_H
 
+#include <cassert>
 #include <initializer_list>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
-#include "s21_list.h"
+#include "s21_deque.h"
 
 namespace s21 {
 
-template <typename T>
+// Container -- любой последовательный контейнер с push_back, pop_back и back
+// (s21::deque, s21::list, s21::vector, s21::ring_buffer) или, если pop_back у
+// него нет, с push_front, pop_front и front (s21::forward_list)
+template <typename T, typename Container = s21::deque<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
 
-  stack() : l() {}
-  stack(std::initializer_list<value_type> const &items) : l() {
+  stack() : container_() {}
+  stack(std::initializer_list<value_type> const &items) : container_() {
     for (auto it : items) {
-      l.push_front(it);
+      push(it);
     }
   }
 
-  stack(const stack &s) : l(s.l) {}
+  stack(const stack &s) : container_(s.container_) {}
 
-  stack(stack &&s) : l(std::move(s.l)) {}
+  stack(stack &&s) : container_(std::move(s.container_)) {}
 
-  ~stack() { this->l.clear(); }
+  ~stack() { this->container_.clear(); }
 
   stack &operator=(stack &&s) {
-    this->l = std::move(s.l);
+    this->container_ = std::move(s.container_);
     return *this;
   }
 
-  const_reference top() { return l.front(); }
+  reference top() {
+    if constexpr (kTopAtBack) {
+      return container_.back();
+    } else {
+      return container_.front();
+    }
+  }
+
+  bool empty() { return container_.empty(); }
+
+  size_type size() { return container_.size(); }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    if constexpr (kTopAtBack) {
+      return this->container_.emplace_back(std::forward<Args>(args)...);
+    } else {
+      return this->container_.emplace_front(std::forward<Args>(args)...);
+    }
+  }
 
-  bool empty() { return l.empty(); }
+  void pop() {
+    if constexpr (kTopAtBack) {
+      this->container_.pop_back();
+    } else {
+      this->container_.pop_front();
+    }
+  }
 
-  size_type size() { return l.size(); }
+  // извлекает вершину перемещением
+  value_type pop_value() {
+    assert(!container_.empty());
+    value_type value = std::move(top());
+    pop();
+    return value;
+  }
 
-  void push(const_reference &value) { this->l.push_front(value); }
-  void pop() { this->l.pop_front(); }
-  void swap(stack &other) { this->l.swap(other.l); }
+  bool try_pop(reference value) {
+    if (container_.empty()) {
+      return false;
+    }
+    value = std::move(top());
+    pop();
+    return true;
+  }
+
+  void swap(stack &other) { this->container_.swap(other.container_); }
 
   template <typename... Args>
   void insert_many_front(Args &&...args) {
@@ -50,9 +98,18 @@ class stack {
   }
 
  private:
-  s21::list<value_type> l;
+  template <typename C, typename = void>
+  struct HasPopBack : std::false_type {};
+
+  template <typename C>
+  struct HasPopBack<C, std::void_t<decltype(std::declval<C &>().pop_back())>>
+      : std::true_type {};
+
+  static constexpr bool kTopAtBack = HasPopBack<container_type>::value;
+
+  container_type container_;
 };
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
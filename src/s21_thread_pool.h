@@ -0,0 +1,369 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_concurrency/s21_sync.h"
+#include "s21_queue.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+
+// Пул потоков с перехватом работы. У каждого рабочего потока свой дек
+// Чейза -- Лева: задачи, порожденные внутри пула, кладутся в дек текущего
+// потока и берутся оттуда же в порядке LIFO, а простаивающий поток крадет
+// самую старую задачу у случайно выбранной жертвы. Задачи от внешних потоков
+// попадают в общую очередь под мьютексом. Поток, не нашедший работы, сначала
+// коротко крутится и только потом засыпает на condition_variable.
+//
+// Деструктор дожидается выполнения всех уже поставленных задач.
+class thread_pool {
+ public:
+  using size_type = size_t;
+
+  // при threads == 0 берется число аппаратных потоков
+  explicit thread_pool(size_type threads = 0)
+      : count_(threads != 0 ? threads : DefaultThreads()),
+        workers_(new Worker[count_]) {
+    try {
+      for (size_type i = 0; i < count_; ++i) {
+        workers_[i].thread = std::thread(&thread_pool::WorkerLoop, this, i);
+      }
+    } catch (...) {
+      Shutdown();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool &other) = delete;
+  thread_pool &operator=(const thread_pool &other) = delete;
+
+  ~thread_pool() { Shutdown(); }
+
+  size_type size() const noexcept { return count_; }
+
+  // ставит f(args...) в очередь; результат или исключение -- через future
+  template <typename F, typename... Args>
+  auto submit(F &&f, Args &&...args)
+      -> std::future<std::invoke_result_t<std::decay_t<F>,
+                                          std::decay_t<Args>...>> {
+    using result_type =
+        std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+    std::packaged_task<result_type()> job(
+        [func = std::forward<F>(f),
+         bound = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+          return std::apply(std::move(func), std::move(bound));
+        });
+    std::future<result_type> future = job.get_future();
+    Schedule(1, [&job](size_type) { return MakeTask(std::move(job)); });
+    return future;
+  }
+
+  // вызывает body(i) для всех i из [first, last), разбивая диапазон на
+  // куски по grain индексов (grain == 0 -- подобрать автоматически).
+  // Вызывающий поток сам выполняет первый кусок, а затем помогает пулу, пока
+  // не завершатся остальные, поэтому вложенные вызовы из задач пула не
+  // блокируют рабочие потоки. Первое выброшенное body исключение
+  // пробрасывается наружу.
+  template <typename Index, typename Function>
+  void parallel_for(Index first, Index last, Function &&body,
+                    size_type grain = 0) {
+    static_assert(std::is_integral<Index>::value,
+                  "parallel_for expects an integral index");
+    if (!(first < last)) {
+      return;
+    }
+    size_type total = static_cast<size_type>(last - first);
+    if (grain == 0) {
+      grain = std::max<size_type>(1, total / (count_ * kChunksPerWorker));
+    }
+    size_type chunks = (total - 1) / grain + 1;
+
+    std::atomic<size_type> remaining{chunks};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto run_chunk = [&](size_type chunk) {
+      size_type begin = chunk * grain;
+      size_type end = std::min(total, begin + grain);
+      try {
+        for (size_type i = begin; i < end; ++i) {
+          body(static_cast<Index>(first + static_cast<Index>(i)));
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      remaining.fetch_sub(1, std::memory_order_release);
+    };
+
+    // если поставить все куски в пул не удалось, остаток выполняется здесь
+    size_type scheduled = 0;
+    try {
+      Schedule(
+          chunks - 1,
+          [&run_chunk](size_type chunk) {
+            return MakeTask([&run_chunk, chunk]() { run_chunk(chunk + 1); });
+          },
+          &scheduled);
+    } catch (...) {
+    }
+    run_chunk(0);
+    for (size_type chunk = scheduled + 1; chunk < chunks; ++chunk) {
+      run_chunk(chunk);
+    }
+
+    size_type index = CurrentIndex();
+    Backoff backoff;
+    while (remaining.load(std::memory_order_acquire) != 0) {
+      if (Task *task = FindTask(index)) {
+        Execute(task);
+        backoff.Reset();
+      } else {
+        backoff.Pause();
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  struct Task {
+    virtual ~Task() = default;
+    virtual void Run() = 0;
+  };
+
+  template <typename Function>
+  struct FunctionTask : Task {
+    explicit FunctionTask(Function &&f) : function(std::move(f)) {}
+    void Run() override { function(); }
+    Function function;
+  };
+
+  struct Worker {
+    work_stealing_deque<Task *> deque;
+    std::thread thread;
+  };
+
+  // принадлежность текущего потока пулу и его генератор для выбора жертвы
+  struct Context {
+    const thread_pool *pool = nullptr;
+    size_type index = kNotWorker;
+    std::uint32_t state = 0;
+  };
+
+  static constexpr size_type kNotWorker = std::numeric_limits<size_type>::max();
+  static constexpr size_type kChunksPerWorker = 4;
+
+  const size_type count_;
+  std::unique_ptr<Worker[]> workers_;
+
+  s21::queue<Task *> injected_;
+  std::atomic<size_type> injected_size_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+
+  // поставленные, но еще не взятые на выполнение задачи
+  std::atomic<size_type> pending_{0};
+  std::atomic<size_type> sleepers_{0};
+
+  static size_type DefaultThreads() noexcept {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware != 0 ? hardware : 1;
+  }
+
+  template <typename Function>
+  static Task *MakeTask(Function &&f) {
+    return new FunctionTask<std::decay_t<Function>>(std::forward<Function>(f));
+  }
+
+  static Context &Current() noexcept {
+    thread_local Context context;
+    return context;
+  }
+
+  size_type CurrentIndex() const noexcept {
+    const Context &context = Current();
+    return context.pool == this ? context.index : kNotWorker;
+  }
+
+  // ставит count задач make(0) ... make(count - 1): из рабочего потока -- в
+  // его дек, из внешнего -- в общую очередь за один захват мьютекса.
+  // pending_ растет заранее, чтобы взявший задачу поток не ушел в минус;
+  // если make или push бросит, неразмещенный остаток из pending_ вычитается,
+  // а число размещенных задач попадает в scheduled
+  template <typename Make>
+  void Schedule(size_type count, Make make, size_type *scheduled = nullptr) {
+    if (count == 0) {
+      return;
+    }
+    pending_.fetch_add(count);
+    size_type pushed = 0;
+    try {
+      size_type index = CurrentIndex();
+      if (index != kNotWorker) {
+        for (; pushed < count; ++pushed) {
+          Push(workers_[index].deque, make(pushed));
+        }
+      } else {
+        std::lock_guard<std::mutex> lock(mutex_);
+        try {
+          for (; pushed < count; ++pushed) {
+            Push(injected_, make(pushed));
+          }
+        } catch (...) {
+          injected_size_.store(injected_.size(), std::memory_order_release);
+          throw;
+        }
+        injected_size_.store(injected_.size(), std::memory_order_release);
+      }
+    } catch (...) {
+      pending_.fetch_sub(count - pushed);
+      if (scheduled != nullptr) {
+        *scheduled = pushed;
+      }
+      Wake(pushed);
+      throw;
+    }
+    if (scheduled != nullptr) {
+      *scheduled = pushed;
+    }
+    Wake(count);
+  }
+
+  template <typename Container>
+  static void Push(Container &container, Task *task) {
+    try {
+      container.push(task);
+    } catch (...) {
+      delete task;
+      throw;
+    }
+  }
+
+  void Wake(size_type count) {
+    // pending_ и sleepers_ меняются в противоположном порядке в WorkerLoop,
+    // поэтому хотя бы одна из сторон увидит изменение другой
+    if (count != 0 && sleepers_.load() != 0) {
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      if (count == 1) {
+        cv_.notify_one();
+      } else {
+        cv_.notify_all();
+      }
+    }
+  }
+
+  Task *FindTask(size_type index) {
+    Task *task = nullptr;
+    if (index != kNotWorker && workers_[index].deque.pop(task)) {
+      return Taken(task);
+    }
+    if (injected_size_.load(std::memory_order_acquire) != 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!injected_.empty()) {
+        task = injected_.front();
+        injected_.pop();
+        injected_size_.store(injected_.size(), std::memory_order_release);
+        return Taken(task);
+      }
+    }
+    size_type start = NextRandom() % count_;
+    for (size_type i = 0; i < count_; ++i) {
+      size_type victim = (start + i) % count_;
+      if (victim != index && workers_[victim].deque.steal(task)) {
+        return Taken(task);
+      }
+    }
+    return nullptr;
+  }
+
+  Task *Taken(Task *task) noexcept {
+    pending_.fetch_sub(1);
+    return task;
+  }
+
+  static void Execute(Task *task) {
+    std::unique_ptr<Task> owned(task);
+    owned->Run();
+  }
+
+  static std::uint32_t NextRandom() noexcept {
+    Context &context = Current();
+    if (context.state == 0) {
+      context.state = static_cast<std::uint32_t>(
+          std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1);
+    }
+    std::uint32_t &state = context.state;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  void WorkerLoop(size_type index) {
+    Context &context = Current();
+    context.pool = this;
+    context.index = index;
+    for (;;) {
+      Backoff backoff;
+      Task *task = FindTask(index);
+      while (task == nullptr && backoff.IsSpinning()) {
+        backoff.Pause();
+        task = FindTask(index);
+      }
+      if (task != nullptr) {
+        Execute(task);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      sleepers_.fetch_add(1);
+      cv_.wait(lock, [this]() { return stop_ || pending_.load() != 0; });
+      sleepers_.fetch_sub(1);
+      if (stop_ && pending_.load() == 0) {
+        return;
+      }
+    }
+  }
+
+  void Shutdown() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (size_type i = 0; i < count_; ++i) {
+      if (workers_[i].thread.joinable()) {
+        workers_[i].thread.join();
+      }
+    }
+  }
+};
+
+// общий пул на весь процесс: создается при первом обращении, потоки живут
+// до выхода из программы
+inline thread_pool &default_thread_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef S21_TIMER_WHEEL_H
+#define S21_TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Иерархическое колесо таймеров (Varghese, Lauck). Время -- целое число
+// тиков, длительность тика выбирает вызывающий. Уровень level состоит из
+// 2^slot_bits ячеек, каждая из которых покрывает 2^(slot_bits * level)
+// тиков. Таймер кладется на самый низкий уровень, выше которого его срок и
+// текущее время совпадают; когда младшие разряды текущего времени
+// обнуляются, ячейка верхнего уровня "осыпается" на нижние. Поэтому
+// schedule, cancel и один тик advance стоят O(1) без учета срабатывающих и
+// переносимых таймеров.
+//
+// Таймеры лежат в пуле узлов, который растет кусками и не перемещает узлы;
+// ячейки -- интрусивные двусвязные списки индексов узлов. Дескриптор --
+// индекс узла и его поколение, поэтому отмена уже сработавшего таймера
+// безопасна и ничего не делает.
+template <typename T>
+class timer_wheel {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using tick_type = std::uint64_t;
+  using handle_type = std::uint64_t;
+
+  explicit timer_wheel(size_type levels = 4, size_type slot_bits = 8,
+                       tick_type now = 0)
+      : levels_(levels), slot_bits_(slot_bits), now_(now) {
+    if (levels == 0 || slot_bits == 0 || slot_bits > kMaxSlotBits ||
+        levels * slot_bits > 64) {
+      throw std::invalid_argument("\n bad timer wheel geometry\n");
+    }
+    size_type slots = levels_ << slot_bits_;
+    for (size_type i = 0; i < slots; ++i) {
+      heads_.push_back(kNull);
+    }
+  }
+
+  timer_wheel(const timer_wheel &other) = delete;
+  timer_wheel &operator=(const timer_wheel &other) = delete;
+
+  ~timer_wheel() {
+    for (size_type i = 0; i < heads_.size(); ++i) {
+      for (index_type index = heads_[i]; index != kNull;) {
+        Node &node = At(index);
+        index = node.next;
+        node.Value()->~value_type();
+      }
+    }
+    for (size_type i = 0; i < chunks_.size(); ++i) {
+      delete[] chunks_[i];
+    }
+  }
+
+  // срабатывает через delay тиков (не раньше следующего тика)
+  handle_type schedule(tick_type delay, const_reference value) {
+    return emplace(delay, value);
+  }
+  handle_type schedule(tick_type delay, value_type &&value) {
+    return emplace(delay, std::move(value));
+  }
+
+  template <typename... Args>
+  handle_type emplace(tick_type delay, Args &&...args) {
+    index_type index = AllocateNode();
+    Node &node = At(index);
+    try {
+      new (node.storage) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      FreeNode(index);
+      throw;
+    }
+    node.deadline = now_ + (delay == 0 ? 1 : delay);
+    Place(index);
+    ++size_;
+    return Pack(index, node.generation);
+  }
+
+  // false, если таймер уже сработал или отменен
+  bool cancel(handle_type handle) {
+    if (!contains(handle)) {
+      return false;
+    }
+    index_type index = IndexOf(handle);
+    Unlink(index);
+    At(index).Value()->~value_type();
+    FreeNode(index);
+    --size_;
+    return true;
+  }
+
+  bool contains(handle_type handle) const noexcept {
+    index_type index = IndexOf(handle);
+    if (index >= capacity_) {
+      return false;
+    }
+    const Node &node = At(index);
+    return node.slot != kNull && node.generation == GenerationOf(handle);
+  }
+
+  // продвигает время на ticks тиков и для каждого истекшего таймера
+  // вызывает on_expire(value_type &); возвращает число сработавших.
+  // Из on_expire можно ставить и отменять таймеры.
+  template <typename OnExpire>
+  size_type advance(tick_type ticks, OnExpire on_expire) {
+    size_type fired = 0;
+    for (; ticks != 0; --ticks) {
+      if (size_ == 0) {
+        now_ += ticks;
+        break;
+      }
+      ++now_;
+      Cascade();
+      fired += Fire(on_expire);
+    }
+    return fired;
+  }
+
+  tick_type now() const noexcept { return now_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+ private:
+  using index_type = std::uint32_t;
+
+  static constexpr index_type kNull = ~index_type{0};
+  static constexpr size_type kMaxSlotBits = 16;
+  static constexpr size_type kChunkBits = 8;
+  static constexpr size_type kChunkSize = size_type{1} << kChunkBits;
+
+  struct Node {
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+    tick_type deadline = 0;
+    index_type prev = kNull;
+    index_type next = kNull;
+    // ячейка, в списке которой лежит узел; kNull -- узел свободен
+    index_type slot = kNull;
+    std::uint32_t generation = 1;
+
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+  };
+
+  const size_type levels_;
+  const size_type slot_bits_;
+  tick_type now_;
+  size_type size_ = 0;
+
+  s21::vector<index_type> heads_;
+  s21::vector<Node *> chunks_;
+  size_type capacity_ = 0;
+  index_type free_ = kNull;
+
+  static handle_type Pack(index_type index, std::uint32_t generation) {
+    return (handle_type{generation} << 32) | index;
+  }
+  static index_type IndexOf(handle_type handle) noexcept {
+    return static_cast<index_type>(handle);
+  }
+  static std::uint32_t GenerationOf(handle_type handle) noexcept {
+    return static_cast<std::uint32_t>(handle >> 32);
+  }
+
+  Node &At(index_type index) const noexcept {
+    return chunks_[index >> kChunkBits][index & (kChunkSize - 1)];
+  }
+
+  index_type AllocateNode() {
+    if (free_ == kNull) {
+      chunks_.push_back(new Node[kChunkSize]);
+      index_type first = static_cast<index_type>(capacity_);
+      capacity_ += kChunkSize;
+      for (size_type i = kChunkSize; i-- > 0;) {
+        At(first + static_cast<index_type>(i)).next = free_;
+        free_ = first + static_cast<index_type>(i);
+      }
+    }
+    index_type index = free_;
+    free_ = At(index).next;
+    return index;
+  }
+
+  void FreeNode(index_type index) noexcept {
+    Node &node = At(index);
+    node.slot = kNull;
+    ++node.generation;
+    node.next = free_;
+    free_ = index;
+  }
+
+  size_type Digit(tick_type time, size_type level) const noexcept {
+    return static_cast<size_type>(time >> (slot_bits_ * level)) &
+           ((size_type{1} << slot_bits_) - 1);
+  }
+
+  // совпадают ли разряды времени a и b начиная с уровня level
+  bool SameAbove(tick_type a, tick_type b, size_type level) const noexcept {
+    size_type shift = slot_bits_ * level;
+    return shift >= 64 || (a >> shift) == (b >> shift);
+  }
+
+  void Place(index_type index) {
+    Node &node = At(index);
+    size_type level = 0;
+    while (level + 1 < levels_ &&
+           !SameAbove(node.deadline, now_, level + 1)) {
+      ++level;
+    }
+    size_type digit = Digit(node.deadline, level);
+    if (!SameAbove(node.deadline, now_, levels_)) {
+      // срок за горизонтом колеса: таймер ждет в ближайшей осыпающейся ячейке
+      // верхнего уровня и при ее осыпании размещается заново
+      digit = (Digit(now_, level) + 1) & ((size_type{1} << slot_bits_) - 1);
+    }
+    Link(index, static_cast<index_type>((level << slot_bits_) + digit));
+  }
+
+  void Link(index_type index, index_type slot) noexcept {
+    Node &node = At(index);
+    node.slot = slot;
+    node.prev = kNull;
+    node.next = heads_[slot];
+    if (node.next != kNull) {
+      At(node.next).prev = index;
+    }
+    heads_[slot] = index;
+  }
+
+  void Unlink(index_type index) noexcept {
+    Node &node = At(index);
+    if (node.prev != kNull) {
+      At(node.prev).next = node.next;
+    } else {
+      heads_[node.slot] = node.next;
+    }
+    if (node.next != kNull) {
+      At(node.next).prev = node.prev;
+    }
+  }
+
+  // переносит на нижние уровни ячейки, чей период начинается в now_;
+  // верхние уровни обрабатываются первыми, чтобы их таймеры успели
+  // осыпаться до самого нижнего
+  void Cascade() {
+    for (size_type level = levels_; level-- > 1;) {
+      if ((now_ & LowMask(level)) != 0) {
+        continue;
+      }
+      index_type slot = static_cast<index_type>((level << slot_bits_) +
+                                                Digit(now_, level));
+      index_type index = heads_[slot];
+      heads_[slot] = kNull;
+      while (index != kNull) {
+        index_type next = At(index).next;
+        Place(index);
+        index = next;
+      }
+    }
+  }
+
+  tick_type LowMask(size_type level) const noexcept {
+    size_type shift = slot_bits_ * level;
+    return shift >= 64 ? ~tick_type{0} : (tick_type{1} << shift) - 1;
+  }
+
+  template <typename OnExpire>
+  size_type Fire(OnExpire &on_expire) {
+    index_type slot = static_cast<index_type>(Digit(now_, 0));
+    size_type fired = 0;
+    while (heads_[slot] != kNull) {
+      index_type index = heads_[slot];
+      Unlink(index);
+      if (At(index).deadline > now_) {
+        // однуровневое колесо: срок за горизонтом, ждем следующего круга
+        Place(index);
+        continue;
+      }
+      value_type *item = At(index).Value();
+      value_type value = std::move(*item);
+      item->~value_type();
+      FreeNode(index);
+      --size_;
+      ++fired;
+      on_expire(value);
+    }
+    return fired;
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -4,6 +4,10 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -96,6 +100,14 @@ class vector {
 
   const_reference operator[](size_type pos) const { return data_[pos]; }
 
+  reference front() {
+    if (size_ != 0)
+      return data_[0];
+    else {
+      throw std::out_of_range("\n index out of range\n");
+    }
+  }
+
   const_reference front() const {
     if (size_ != 0)
       return data_[0];
@@ -104,6 +116,14 @@ class vector {
     }
   }
 
+  reference back() {
+    if (size_ != 0)
+      return data_[size_ - 1];
+    else {
+      throw std::out_of_range("\n index out of range\n");
+    }
+  }
+
   const_reference back() const {
     if (size_ != 0)
       return data_[size_ - 1];
@@ -143,7 +163,7 @@ class vector {
     } else if (size > capacity_) {
       T *newarr = reinterpret_cast<T *>(new int8_t[size * sizeof(T)]);
       try {
-        std::uninitialized_copy(data_, data_ + size_, newarr);
+        Relocate(newarr);
       } catch (...) {
         delete[] reinterpret_cast<int8_t *>(newarr);
         throw;
@@ -160,7 +180,7 @@ class vector {
     if (capacity_ > size_) {
       T *newarr = reinterpret_cast<T *>(new int8_t[size_ * sizeof(T)]);
       try {
-        std::uninitialized_copy(data_, data_ + size_, newarr);
+        Relocate(newarr);
       } catch (...) {
         delete[] reinterpret_cast<int8_t *>(newarr);
         throw;
@@ -220,15 +240,41 @@ class vector {
     data_ = newarr;
   }
 
-  void push_back(const_reference value) {
-    if (size_ == capacity_) {
-      if (capacity_ == 0)
-        reserve(1);
-      else
-        reserve(capacity_ * 2);
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // при нехватке места новый элемент строится в новом буфере раньше, чем
+  // туда переносятся старые, поэтому аргумент может ссылаться на элемент
+  // самого вектора
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ != capacity_) {
+      new (data_ + size_) T(std::forward<Args>(args)...);
+    } else {
+      size_type size = capacity_ == 0 ? 1 : capacity_ * 2;
+      if (size > this->max_size()) {
+        throw std::out_of_range("\n bigger then max size\n");
+      }
+      T *newarr = reinterpret_cast<T *>(new int8_t[size * sizeof(T)]);
+      try {
+        new (newarr + size_) T(std::forward<Args>(args)...);
+      } catch (...) {
+        delete[] reinterpret_cast<int8_t *>(newarr);
+        throw;
+      }
+      try {
+        Relocate(newarr);
+      } catch (...) {
+        newarr[size_].~T();
+        delete[] reinterpret_cast<int8_t *>(newarr);
+        throw;
+      }
+      DeleteVector();
+      data_ = newarr;
+      capacity_ = size;
     }
-    new (data_ + size_) T(value);
     size_ += 1;
+    return data_[size_ - 1];
   }
 
   void pop_back() {
@@ -272,6 +318,18 @@ class vector {
   size_type capacity_;
   size_type size_;
 
+  // переносит элементы в неинициализированный буфер: перемещением, если
+  // оно не бросает исключений (или копировать нельзя), иначе копированием,
+  // чтобы при исключении исходный вектор остался нетронутым
+  void Relocate(T *newarr) {
+    if constexpr (std::is_nothrow_move_constructible<T>::value ||
+                  !std::is_copy_constructible<T>::value) {
+      std::uninitialized_move(data_, data_ + size_, newarr);
+    } else {
+      std::uninitialized_copy(data_, data_ + size_, newarr);
+    }
+  }
+
   void DeleteVector() {
     if (data_) {
       for (size_t i = 0; i < size_; ++i) {
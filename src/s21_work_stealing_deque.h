@@ -0,0 +1,153 @@
+#ifndef S21_WORK_STEALING_DEQUE_H
+#define S21_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "s21_concurrency/s21_sync.h"
+
+namespace s21 {
+
+// Дек Чейза -- Лева с упорядочиванием памяти по Lê, Pop, Cohen, Zappa Nardelli
+// (PPoPP'13). Владелец кладет и забирает элементы с нижнего конца (LIFO),
+// остальные потоки крадут с верхнего (FIFO). Владелец и вор конфликтуют
+// только за последний элемент. Буфер -- кольцо степени двойки; при росте
+// старые буферы не освобождаются до уничтожения дека, потому что вор еще
+// может читать из них.
+//
+// T хранится в std::atomic, поэтому должен быть тривиально копируемым --
+// обычно это указатель на задачу.
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "work_stealing_deque stores its items in std::atomic");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit work_stealing_deque(size_type capacity = 64)
+      : array_(new Array(RoundUpToPowerOfTwo(capacity), nullptr)) {}
+
+  work_stealing_deque(const work_stealing_deque &other) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &other) = delete;
+
+  ~work_stealing_deque() {
+    Array *array = array_.load(std::memory_order_relaxed);
+    while (array != nullptr) {
+      Array *previous = array->previous;
+      delete array;
+      array = previous;
+    }
+  }
+
+  // только владелец
+  void push(value_type value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Array *array = array_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<std::int64_t>(array->capacity) - 1) {
+      array = Grow(array, top, bottom);
+    }
+    array->Put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // только владелец
+  bool pop(value_type &value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array *array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+
+    bool taken = false;
+    if (top <= bottom) {
+      value = array->Get(bottom);
+      taken = true;
+      if (top == bottom) {
+        // последний элемент: соревнуемся с ворами
+        taken = top_.compare_exchange_strong(top, top + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return taken;
+  }
+
+  // любой поток; false, если дек пуст или элемент перехватил другой поток
+  bool steal(value_type &value) {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    Array *array = array_.load(std::memory_order_acquire);
+    value_type item = array->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    value = item;
+    return true;
+  }
+
+  // из других потоков значения ниже -- лишь мгновенный снимок
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+
+ private:
+  struct Array {
+    size_type capacity;
+    size_type mask;
+    std::atomic<value_type> *slots;
+    Array *previous;
+
+    Array(size_type size, Array *prev)
+        : capacity(size),
+          mask(size - 1),
+          slots(new std::atomic<value_type>[size]),
+          previous(prev) {}
+
+    ~Array() { delete[] slots; }
+
+    value_type Get(std::int64_t index) const noexcept {
+      return slots[static_cast<size_type>(index) & mask].load(
+          std::memory_order_relaxed);
+    }
+
+    void Put(std::int64_t index, value_type value) noexcept {
+      slots[static_cast<size_type>(index) & mask].store(
+          value, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Array *> array_;
+
+  Array *Grow(Array *array, std::int64_t top, std::int64_t bottom) {
+    Array *grown = new Array(array->capacity * 2, array);
+    for (std::int64_t i = top; i < bottom; ++i) {
+      grown->Put(i, array->Get(i));
+    }
+    array_.store(grown, std::memory_order_release);
+    return grown;
+  }
+};
+
+}  // namespace s21
+
+#endif
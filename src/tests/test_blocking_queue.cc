@@ -0,0 +1,135 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "tests_init.h"
+
+TEST(blocking_queue, pushPop) {
+  s21::blocking_queue<int> queue;
+  EXPECT_TRUE(queue.empty());
+
+  queue.push(1);
+  queue.push(2);
+  EXPECT_EQ(queue.size(), 2U);
+  EXPECT_EQ(queue.pop(), 1);
+
+  int value = 0;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(blocking_queue, popForTimeout) {
+  s21::blocking_queue<int> queue;
+  int value = 0;
+  EXPECT_FALSE(queue.pop_for(value, std::chrono::milliseconds(10)));
+
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.push(42);
+  });
+  EXPECT_TRUE(queue.pop_for(value, std::chrono::seconds(10)));
+  EXPECT_EQ(value, 42);
+  producer.join();
+}
+
+TEST(blocking_queue, batch) {
+  s21::blocking_queue<int> queue;
+  int input[6] = {1, 2, 3, 4, 5, 6};
+  queue.push_batch(input, input + 6);
+  EXPECT_EQ(queue.size(), 6U);
+
+  int output[6] = {};
+  EXPECT_EQ(queue.drain_into(output, 4), 4U);
+  EXPECT_EQ(queue.drain_into(output + 4, 4), 2U);
+  EXPECT_EQ(queue.drain_into(output, 0), 0U);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(output[i], i + 1);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+namespace {
+struct FailingCopy {
+  int value;
+  bool fail;
+  FailingCopy(int v = 0, bool f = false) : value(v), fail(f) {}
+  FailingCopy(const FailingCopy &other) : value(other.value), fail(false) {
+    if (other.fail) {
+      throw std::runtime_error("copy failed");
+    }
+  }
+  FailingCopy &operator=(const FailingCopy &other) = default;
+};
+}  // namespace
+
+TEST(blocking_queue, batchPublishesPrefixOnThrow) {
+  s21::blocking_queue<FailingCopy> queue;
+  FailingCopy input[4] = {{1}, {2}, {3, true}, {4}};
+  FailingCopy first;
+  bool popped = false;
+  auto started = std::chrono::steady_clock::now();
+  std::thread consumer([&]() {
+    popped = queue.pop_for(first, std::chrono::seconds(10));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_THROW(queue.push_batch(input, input + 4), std::runtime_error);
+  consumer.join();
+  EXPECT_TRUE(popped);
+  EXPECT_LT(std::chrono::steady_clock::now() - started,
+            std::chrono::seconds(5));
+  EXPECT_EQ(first.value, 1);
+  EXPECT_EQ(queue.size(), 1U);
+  EXPECT_EQ(queue.pop().value, 2);
+}
+
+TEST(blocking_queue, manyThreads) {
+  const int kThreads = 4;
+  const long kPerProducer = 50000;
+  s21::blocking_queue<long> queue;
+  std::atomic<long> sum{0};
+
+  std::thread producers[kThreads];
+  std::thread consumers[kThreads];
+  for (int t = 0; t < kThreads; ++t) {
+    producers[t] = std::thread([&queue, t, kPerProducer]() {
+      long batch[10];
+      for (long i = 0; i < kPerProducer; i += 10) {
+        for (long j = 0; j < 10; ++j) {
+          batch[j] = t * kPerProducer + i + j;
+        }
+        if (i % 20 == 0) {
+          queue.push_batch(batch, batch + 10);
+        } else {
+          for (long j = 0; j < 10; ++j) {
+            queue.push(batch[j]);
+          }
+        }
+      }
+    });
+    consumers[t] = std::thread([&queue, &sum, kPerProducer]() {
+      long local = 0;
+      long taken = 0;
+      long batch[16];
+      while (taken < kPerProducer) {
+        long max = kPerProducer - taken < 16 ? kPerProducer - taken : 16;
+        size_t count = queue.drain_into(batch, max);
+        for (size_t i = 0; i < count; ++i) {
+          local += batch[i];
+        }
+        taken += count;
+      }
+      sum += local;
+    });
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    producers[t].join();
+    consumers[t].join();
+  }
+
+  long total = kThreads * kPerProducer;
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,98 @@
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "tests_init.h"
+
+TEST(concurrent_stack, pushPop) {
+  s21::concurrent_stack<std::string> stack;
+  EXPECT_TRUE(stack.empty());
+
+  stack.push("a");
+  stack.push(std::string("b"));
+  stack.emplace(2, 'c');
+  EXPECT_FALSE(stack.empty());
+
+  std::string value;
+  for (const char *expected : {"cc", "b", "a"}) {
+    EXPECT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, poolGrowthAndReuse) {
+  s21::concurrent_stack<int> stack(10);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      stack.push(i);
+    }
+    int value = -1;
+    for (int i = 999; i >= 0; --i) {
+      EXPECT_TRUE(stack.try_pop(value));
+      EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(stack.try_pop(value));
+  }
+}
+
+TEST(concurrent_stack, reserveBeyondFirstChunk) {
+  for (size_t reserve : {65, 100, 1000}) {
+    s21::concurrent_stack<int> stack(reserve);
+    for (size_t i = 0; i < reserve; ++i) {
+      stack.push(static_cast<int>(i));
+    }
+    int value = -1;
+    for (size_t i = reserve; i > 0; --i) {
+      EXPECT_TRUE(stack.try_pop(value));
+      EXPECT_EQ(value, static_cast<int>(i - 1));
+    }
+    EXPECT_TRUE(stack.empty());
+  }
+}
+
+TEST(concurrent_stack, leftoversDestroyed) {
+  s21::concurrent_stack<std::string> stack;
+  for (int i = 0; i < 100; ++i) {
+    stack.push(std::string(100, 'x'));
+  }
+}
+
+TEST(concurrent_stack, manyThreads) {
+  const int kThreads = 8;
+  const long kPerThread = 50000;
+  s21::concurrent_stack<long> stack;
+  std::atomic<long> sum{0};
+  std::atomic<long> popped{0};
+
+  std::thread threads[kThreads];
+  for (int t = 0; t < kThreads; ++t) {
+    threads[t] = std::thread([&stack, &sum, &popped, t, kPerThread]() {
+      long local_sum = 0;
+      long local_popped = 0;
+      for (long i = 0; i < kPerThread; ++i) {
+        stack.push(t * kPerThread + i);
+        long value;
+        if (i % 2 == 0 && stack.try_pop(value)) {
+          local_sum += value;
+          ++local_popped;
+        }
+      }
+      sum += local_sum;
+      popped += local_popped;
+    });
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    threads[t].join();
+  }
+
+  long value;
+  while (stack.try_pop(value)) {
+    sum += value;
+    ++popped;
+  }
+  long total = kThreads * kPerThread;
+  EXPECT_EQ(popped.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "tests_init.h"
+
+namespace {
+
+template <typename T>
+void ExpectEqual(const s21::deque<T> &s21_deque,
+                 const std::deque<T> &std_deque) {
+  ASSERT_EQ(s21_deque.size(), std_deque.size());
+  for (size_t i = 0; i < std_deque.size(); ++i) {
+    ASSERT_EQ(s21_deque[i], std_deque[i]) << i;
+  }
+}
+
+TEST(deque, constructors) {
+  s21::deque<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::deque<std::string> s21_deque = {"a", "b", "c"};
+  s21::deque<std::string> copy(s21_deque);
+  s21::deque<std::string> moved(std::move(s21_deque));
+  EXPECT_TRUE(s21_deque.empty());
+  ExpectEqual(copy, std::deque<std::string>{"a", "b", "c"});
+  ExpectEqual(moved, std::deque<std::string>{"a", "b", "c"});
+
+  copy = s21::deque<std::string>{"x"};
+  moved = copy;
+  ExpectEqual(moved, std::deque<std::string>{"x"});
+}
+
+TEST(deque, pushPopBothEnds) {
+  s21::deque<int> s21_deque;
+  std::deque<int> std_deque;
+  for (int i = 0; i < 1000; ++i) {
+    s21_deque.push_back(i);
+    std_deque.push_back(i);
+    s21_deque.push_front(-i);
+    std_deque.push_front(-i);
+  }
+  ExpectEqual(s21_deque, std_deque);
+  EXPECT_EQ(s21_deque.front(), std_deque.front());
+  EXPECT_EQ(s21_deque.back(), std_deque.back());
+
+  for (int i = 0; i < 700; ++i) {
+    s21_deque.pop_front();
+    std_deque.pop_front();
+  }
+  for (int i = 0; i < 700; ++i) {
+    s21_deque.pop_back();
+    std_deque.pop_back();
+  }
+  ExpectEqual(s21_deque, std_deque);
+
+  s21_deque.clear();
+  EXPECT_TRUE(s21_deque.empty());
+  s21_deque.pop_back();
+  s21_deque.pop_front();
+  s21_deque.push_front(7);
+  EXPECT_EQ(s21_deque.back(), 7);
+}
+
+TEST(deque, randomOperations) {
+  s21::deque<int> s21_deque;
+  std::deque<int> std_deque;
+  std::mt19937 random(42);
+  for (int i = 0; i < 100000; ++i) {
+    int value = static_cast<int>(random());
+    switch (random() % 4) {
+      case 0:
+        s21_deque.push_back(value);
+        std_deque.push_back(value);
+        break;
+      case 1:
+        s21_deque.push_front(value);
+        std_deque.push_front(value);
+        break;
+      case 2:
+        if (!std_deque.empty()) {
+          s21_deque.pop_back();
+          std_deque.pop_back();
+        }
+        break;
+      default:
+        if (!std_deque.empty()) {
+          s21_deque.pop_front();
+          std_deque.pop_front();
+        }
+        break;
+    }
+  }
+  ExpectEqual(s21_deque, std_deque);
+}
+
+TEST(deque, queueLikeChurn) {
+  // очередь постоянного размера ползет вдоль карты: карта должна
+  // перецентрироваться, а не расти
+  s21::deque<int> s21_deque;
+  for (int i = 0; i < 10; ++i) {
+    s21_deque.push_back(i);
+  }
+  for (int i = 10; i < 100000; ++i) {
+    s21_deque.push_back(i);
+    EXPECT_EQ(s21_deque.front(), i - 10);
+    s21_deque.pop_front();
+  }
+  EXPECT_EQ(s21_deque.size(), 10U);
+  EXPECT_EQ(s21_deque.back(), 99999);
+}
+
+TEST(deque, accessAndIterators) {
+  s21::deque<int> s21_deque = {5, 3, 9, 1, 7};
+  EXPECT_EQ(s21_deque.at(2), 9);
+  EXPECT_THROW(s21_deque.at(5), std::out_of_range);
+
+  std::sort(s21_deque.begin(), s21_deque.end());
+  ExpectEqual(s21_deque, std::deque<int>{1, 3, 5, 7, 9});
+
+  s21::deque<int>::iterator it = s21_deque.begin() + 1;
+  *it = 4;
+  EXPECT_EQ(it[1], 5);
+  EXPECT_EQ(s21_deque.end() - it, 4);
+  s21::deque<int>::const_iterator const_it = it;
+  EXPECT_EQ(*const_it, 4);
+  EXPECT_TRUE(const_it < s21_deque.cend());
+
+  const s21::deque<int> &const_deque = s21_deque;
+  int sum = 0;
+  for (int value : const_deque) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 26);
+}
+
+TEST(deque, moveOnlyAndEmplace) {
+  s21::deque<std::unique_ptr<int>> s21_deque;
+  s21_deque.push_back(std::make_unique<int>(1));
+  s21_deque.emplace_front(new int(0));
+  s21_deque.emplace_back(new int(2));
+  EXPECT_EQ(*s21_deque.front(), 0);
+  EXPECT_EQ(*s21_deque[1], 1);
+  std::unique_ptr<int> last = std::move(s21_deque.back());
+  EXPECT_EQ(*last, 2);
+}
+
+TEST(deque, insertMany) {
+  s21::deque<int> s21_deque = {3};
+  s21_deque.insert_many_back(4, 5);
+  s21_deque.insert_many_front(2, 1);
+  ExpectEqual(s21_deque, std::deque<int>{1, 2, 3, 4, 5});
+}
+
+TEST(deque, swap) {
+  s21::deque<int> first = {1, 2};
+  s21::deque<int> second = {3};
+  first.swap(second);
+  ExpectEqual(first, std::deque<int>{3});
+  ExpectEqual(second, std::deque<int>{1, 2});
+}
+
+}  // namespace
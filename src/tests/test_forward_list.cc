@@ -0,0 +1,178 @@
+#include <forward_list>
+#include <memory>
+#include <stdexcept>
+
+#include "tests_init.h"
+
+template <typename T>
+static void ExpectEqualLists(const s21::forward_list<T> &s21_list,
+                             const std::forward_list<T> &std_list) {
+  auto s21_it = s21_list.begin();
+  auto std_it = std_list.begin();
+  for (; s21_it != s21_list.end() && std_it != std_list.end();
+       ++s21_it, ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+  }
+  EXPECT_EQ(s21_it, s21_list.end());
+  EXPECT_EQ(std_it, std_list.end());
+}
+
+TEST(forward_list, constructors) {
+  s21::forward_list<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.size(), 0U);
+
+  s21::forward_list<int> sized(4);
+  EXPECT_EQ(sized.size(), 4U);
+  EXPECT_EQ(sized.front(), 0);
+
+  s21::forward_list<int> items = {1, 2, 3};
+  ExpectEqualLists(items, {1, 2, 3});
+
+  s21::forward_list<int> copy(items);
+  ExpectEqualLists(copy, {1, 2, 3});
+
+  s21::forward_list<int> moved(std::move(copy));
+  ExpectEqualLists(moved, {1, 2, 3});
+  EXPECT_TRUE(copy.empty());
+
+  s21::forward_list<int> assigned;
+  assigned = items;
+  ExpectEqualLists(assigned, {1, 2, 3});
+  assigned = s21::forward_list<int>{7};
+  ExpectEqualLists(assigned, {7});
+}
+
+TEST(forward_list, pushPopFront) {
+  s21::forward_list<int> s21_list;
+  std::forward_list<int> std_list;
+  for (int i = 0; i < 10; ++i) {
+    s21_list.push_front(i);
+    std_list.push_front(i);
+    EXPECT_EQ(s21_list.front(), std_list.front());
+  }
+  s21_list.pop_front();
+  std_list.pop_front();
+  ExpectEqualLists(s21_list, std_list);
+  EXPECT_EQ(s21_list.size(), 9U);
+
+  s21_list.clear();
+  EXPECT_TRUE(s21_list.empty());
+}
+
+TEST(forward_list, insertEraseAfter) {
+  s21::forward_list<int> s21_list = {1, 4};
+  std::forward_list<int> std_list = {1, 4};
+
+  auto s21_it = s21_list.insert_after(s21_list.begin(), 2);
+  auto std_it = std_list.insert_after(std_list.begin(), 2);
+  s21_list.insert_after(s21_it, 3);
+  std_list.insert_after(std_it, 3);
+  s21_list.insert_after(s21_list.before_begin(), 0);
+  std_list.insert_after(std_list.before_begin(), 0);
+  ExpectEqualLists(s21_list, std_list);
+  EXPECT_EQ(s21_list.size(), 5U);
+
+  s21_it = s21_list.erase_after(s21_list.begin());
+  std_it = std_list.erase_after(std_list.begin());
+  EXPECT_EQ(*s21_it, *std_it);
+  s21_list.erase_after(s21_list.before_begin());
+  std_list.erase_after(std_list.before_begin());
+  ExpectEqualLists(s21_list, std_list);
+  EXPECT_EQ(s21_list.size(), 3U);
+}
+
+TEST(forward_list, spliceAfter) {
+  s21::forward_list<int> s21_list = {1, 5};
+  s21::forward_list<int> s21_other = {2, 3, 4};
+  std::forward_list<int> std_list = {1, 5};
+  std::forward_list<int> std_other = {2, 3, 4};
+
+  s21_list.splice_after(s21_list.begin(), s21_other);
+  std_list.splice_after(std_list.begin(), std_other);
+  ExpectEqualLists(s21_list, std_list);
+  EXPECT_EQ(s21_list.size(), 5U);
+  EXPECT_TRUE(s21_other.empty());
+
+  s21::forward_list<int> s21_single = {10, 20};
+  std::forward_list<int> std_single = {10, 20};
+  s21_list.splice_after(s21_list.before_begin(), s21_single,
+                        s21_single.begin());
+  std_list.splice_after(std_list.before_begin(), std_single,
+                        std_single.begin());
+  ExpectEqualLists(s21_list, std_list);
+  ExpectEqualLists(s21_single, std_single);
+  EXPECT_EQ(s21_list.size(), 6U);
+  EXPECT_EQ(s21_single.size(), 1U);
+}
+
+TEST(forward_list, sortReverse) {
+  s21::forward_list<int> s21_list;
+  std::forward_list<int> std_list;
+  for (int i = 0; i < 1000; ++i) {
+    int value = rand() % 100;
+    s21_list.push_front(value);
+    std_list.push_front(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  ExpectEqualLists(s21_list, std_list);
+
+  s21_list.reverse();
+  std_list.reverse();
+  ExpectEqualLists(s21_list, std_list);
+  EXPECT_EQ(s21_list.size(), 1000U);
+}
+
+namespace {
+struct LimitedLess {
+  static int budget;
+  int value;
+  bool operator<(const LimitedLess &other) const {
+    if (budget-- == 0) {
+      throw std::runtime_error("comparison failed");
+    }
+    return value < other.value;
+  }
+};
+int LimitedLess::budget = 0;
+}  // namespace
+
+TEST(forward_list, sortKeepsNodesOnThrow) {
+  for (int budget : {0, 1, 7, 300, 2000}) {
+    s21::forward_list<LimitedLess> s21_list;
+    long sum = 0;
+    for (int i = 0; i < 500; ++i) {
+      s21_list.push_front(LimitedLess{(i * 37) % 101});
+      sum += (i * 37) % 101;
+    }
+    LimitedLess::budget = budget;
+    EXPECT_THROW(s21_list.sort(), std::runtime_error);
+    EXPECT_EQ(s21_list.size(), 500U);
+    size_t count = 0;
+    for (const LimitedLess &item : s21_list) {
+      sum -= item.value;
+      ++count;
+    }
+    EXPECT_EQ(count, 500U);
+    EXPECT_EQ(sum, 0);
+  }
+}
+
+TEST(forward_list, insertManyFront) {
+  s21::forward_list<int> s21_list = {3};
+  s21_list.insert_many_front(1, 2);
+  ExpectEqualLists(s21_list, {2, 1, 3});
+}
+
+TEST(forward_list, emplace) {
+  s21::forward_list<std::unique_ptr<int>> s21_list;
+  s21_list.push_front(std::make_unique<int>(3));
+  s21_list.emplace_front(new int(1));
+  s21_list.emplace_after(s21_list.begin(), new int(2));
+  int expected = 1;
+  for (const auto& item : s21_list) {
+    EXPECT_EQ(*item, expected++);
+  }
+  EXPECT_EQ(expected, 4);
+}
@@ -1,4 +1,8 @@
+#include <atomic>
 #include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 #include "tests_init.h"
 
@@ -175,6 +179,194 @@ TEST(list, Sort) {
   }
 }
 
+TEST(list, EraseRange) {
+  s21::list<int> s21_list = {1, 2, 3, 4, 5, 6};
+  std::list<int> std_list = {1, 2, 3, 4, 5, 6};
+
+  auto s21_first = s21_list.begin();
+  ++s21_first;
+  auto s21_last = s21_first;
+  ++s21_last;
+  ++s21_last;
+  auto std_first = std::next(std_list.begin());
+  auto std_last = std::next(std_first, 2);
+
+  auto s21_it = s21_list.erase(s21_first, s21_last);
+  auto std_it = std_list.erase(std_first, std_last);
+  EXPECT_EQ(*s21_it, *std_it);
+  EXPECT_EQ(s21_list.size(), std_list.size());
+
+  s21_list.erase(s21_list.begin(), s21_list.begin());
+  EXPECT_EQ(s21_list.size(), std_list.size());
+
+  s21_it = s21_list.begin();
+  for (auto item : std_list) {
+    EXPECT_EQ(*s21_it, item);
+    ++s21_it;
+  }
+
+  s21_list.erase(s21_list.begin(), s21_list.end());
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_EQ(s21_list.size(), 0U);
+  s21_list.push_back(7);
+  EXPECT_EQ(s21_list.front(), 7);
+  EXPECT_EQ(s21_list.back(), 7);
+}
+
+TEST(list, RemoveIf) {
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 1000; ++i) {
+    int value = rand() % 10;
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+
+  auto is_small = [](const int& value) { return value < 3; };
+  size_t removed = s21_list.remove_if(is_small);
+  size_t expected = std_list.size();
+  std_list.remove_if(is_small);
+  expected -= std_list.size();
+
+  EXPECT_EQ(removed, expected);
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_EQ(s21_list.front(), std_list.front());
+  EXPECT_EQ(s21_list.back(), std_list.back());
+  auto s21_it = s21_list.begin();
+  for (auto item : std_list) {
+    EXPECT_EQ(*s21_it, item);
+    ++s21_it;
+  }
+}
+
+TEST(list, RemoveIfCallsPredicateOncePerElement) {
+  s21::list<int> s21_list = {1, 1, 2, 1, 1, 1, 3};
+  int calls = 0;
+  size_t removed = s21_list.remove_if([&calls](const int& value) {
+    ++calls;
+    return value == 1;
+  });
+  EXPECT_EQ(removed, 5U);
+  EXPECT_EQ(calls, 7);
+  EXPECT_EQ(s21_list.size(), 2U);
+  EXPECT_EQ(s21_list.front(), 2);
+  EXPECT_EQ(s21_list.back(), 3);
+}
+
+TEST(list, Remove) {
+  s21::list<int> s21_list = {5, 5, 1, 5, 2, 5, 5};
+  std::list<int> std_list = {5, 5, 1, 5, 2, 5, 5};
+
+  EXPECT_EQ(s21_list.remove(5), 5U);
+  std_list.remove(5);
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_EQ(s21_list.front(), 1);
+  EXPECT_EQ(s21_list.back(), 2);
+
+  EXPECT_EQ(s21_list.remove(9), 0U);
+  s21_list.remove(s21_list.front());
+  s21_list.remove(s21_list.front());
+  EXPECT_TRUE(s21_list.empty());
+}
+
+TEST(list, ParallelSort) {
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 200000; ++i) {
+    int value = rand() % 1000;
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+
+  s21_list.parallel_sort(5);
+  std_list.sort();
+
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_EQ(s21_list.front(), std_list.front());
+  EXPECT_EQ(s21_list.back(), std_list.back());
+  auto s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+    ++s21_it;
+  }
+  EXPECT_EQ(s21_it, s21_list.end());
+}
+
+TEST(list, ParallelSortSmall) {
+  s21::list<int> s21_list = {3, 2, 5, 1, 4};
+  std::list<int> std_list = {3, 2, 5, 1, 4};
+
+  s21_list.parallel_sort();
+  std_list.sort();
+
+  auto s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+    ++s21_it;
+  }
+}
+
+TEST(list, ParallelSortMoreThreadsThanElements) {
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  unsigned state = 7;
+  for (int i = 0; i < 70000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int value = static_cast<int>(state >> 8);
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+
+  s21_list.parallel_sort(1 << 20);
+  std_list.sort();
+
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  auto s21_it = s21_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end(); ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+    ++s21_it;
+  }
+
+  s21::list<int> small = {3, 1, 2};
+  small.parallel_sort(100);
+  EXPECT_EQ(small.front(), 1);
+  EXPECT_EQ(small.back(), 3);
+}
+
+namespace {
+struct ThrowingKey {
+  static std::atomic<int> budget;
+  int value;
+  bool operator<=(const ThrowingKey& other) const {
+    if (budget.fetch_sub(1) <= 0) {
+      throw std::runtime_error("comparison failed");
+    }
+    return value <= other.value;
+  }
+};
+std::atomic<int> ThrowingKey::budget{0};
+}  // namespace
+
+TEST(list, ParallelSortKeepsNodesOnThrow) {
+  s21::list<ThrowingKey> s21_list;
+  long long sum = 0;
+  for (int i = 0; i < 100000; ++i) {
+    s21_list.push_back(ThrowingKey{(i * 7919) % 100003});
+    sum += (i * 7919) % 100003;
+  }
+  ThrowingKey::budget = 300000;
+  EXPECT_THROW(s21_list.parallel_sort(8), std::runtime_error);
+
+  EXPECT_EQ(s21_list.size(), 100000);
+  size_t count = 0;
+  for (const ThrowingKey& key : s21_list) {
+    sum -= key.value;
+    ++count;
+  }
+  EXPECT_EQ(count, 100000);
+  EXPECT_EQ(sum, 0);
+}
+
 TEST(list, MergeSorted) {
   s21::list<int> s21_list_left = {1, 3, 5};
   s21::list<int> s21_list_right = {2, 4};
@@ -293,7 +485,26 @@ TEST(list, InsertManyFront) {
   EXPECT_EQ(test_list.size(), expected_list.size());
 }
 
+TEST(list, EmplaceAndMove) {
+  s21::list<std::unique_ptr<int>> s21_list;
+  s21_list.push_back(std::make_unique<int>(2));
+  s21_list.emplace_front(new int(1));
+  s21_list.emplace_back(new int(3));
+  s21_list.push_front(std::make_unique<int>(0));
+  EXPECT_EQ(s21_list.size(), 4U);
+  int expected = 0;
+  for (const auto& item : s21_list) {
+    EXPECT_EQ(*item, expected++);
+  }
+  std::unique_ptr<int> first = std::move(s21_list.front());
+  EXPECT_EQ(*first, 0);
+  EXPECT_EQ(*s21_list.back(), 3);
+
+  s21::list<std::string> strings;
+  EXPECT_EQ(strings.emplace_back(2, 'x'), "xx");
+}
+
 // int main(int argc, char **argv) {
 //   ::testing::InitGoogleTest(&argc, argv);
 //   return RUN_ALL_TESTS();
-// }
\ No newline at end of file
+// }
@@ -0,0 +1,122 @@
+#include <string>
+
+#include "tests_init.h"
+
+TEST(lru_cache, getPut) {
+  s21::lru_cache<int, std::string> cache(2);
+  cache.put(1, "one");
+  cache.put(2, "two");
+
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_EQ(cache.get(3), nullptr);
+  EXPECT_EQ(cache.size(), 2U);
+
+  cache.put(3, "three");
+  EXPECT_EQ(cache.get(2), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_EQ(*cache.get(3), "three");
+  EXPECT_EQ(cache.size(), 2U);
+}
+
+TEST(lru_cache, updateExisting) {
+  s21::lru_cache<int, int> cache(2);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(1, 11);
+  cache.put(3, 30);
+
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(*cache.get(1), 11);
+  EXPECT_EQ(*cache.get(3), 30);
+  EXPECT_EQ(cache.evictions(), 1U);
+}
+
+TEST(lru_cache, touch) {
+  s21::lru_cache<int, int> cache(2);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  EXPECT_TRUE(cache.touch(1));
+  EXPECT_FALSE(cache.touch(5));
+  cache.put(3, 30);
+
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(cache.hits(), 0U);
+  EXPECT_EQ(cache.misses(), 0U);
+}
+
+TEST(lru_cache, counters) {
+  s21::lru_cache<int, int> cache(1);
+  cache.put(1, 10);
+  cache.get(1);
+  cache.get(1);
+  cache.get(2);
+  cache.put(2, 20);
+
+  EXPECT_EQ(cache.hits(), 2U);
+  EXPECT_EQ(cache.misses(), 1U);
+  EXPECT_EQ(cache.evictions(), 1U);
+
+  cache.reset_stats();
+  EXPECT_EQ(cache.hits(), 0U);
+  EXPECT_EQ(cache.misses(), 0U);
+  EXPECT_EQ(cache.evictions(), 0U);
+}
+
+TEST(lru_cache, weigherAndCallback) {
+  s21::vector<int> evicted;
+  s21::lru_cache<int, std::string> cache(
+      10,
+      [](const int &, const std::string &value) { return value.size(); },
+      [&evicted](const int &key, const std::string &) {
+        evicted.push_back(key);
+      });
+
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  EXPECT_EQ(cache.weight(), 8U);
+  cache.put(3, "cccc");
+
+  EXPECT_EQ(evicted.size(), 1U);
+  EXPECT_EQ(evicted[0], 1);
+  EXPECT_EQ(cache.weight(), 8U);
+
+  cache.set_capacity(4);
+  EXPECT_EQ(evicted.size(), 2U);
+  EXPECT_EQ(evicted[1], 2);
+  EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST(lru_cache, eraseClear) {
+  s21::lru_cache<int, int> cache(3);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(3, 30);
+
+  EXPECT_TRUE(cache.erase(2));
+  EXPECT_FALSE(cache.erase(2));
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.weight(), 2U);
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.get(1), nullptr);
+}
+
+TEST(lru_cache, churn) {
+  s21::lru_cache<int, int> cache(64);
+  for (int i = 0; i < 10000; ++i) {
+    int key = rand() % 128;
+    if (cache.get(key) == nullptr) {
+      cache.put(key, key * 2);
+    }
+    EXPECT_LE(cache.size(), 64U);
+  }
+  for (int key = 0; key < 128; ++key) {
+    int *value = cache.get(key);
+    if (value != nullptr) {
+      EXPECT_EQ(*value, key * 2);
+    }
+  }
+}
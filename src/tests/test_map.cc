@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "tests_init.h"
@@ -468,3 +469,146 @@ TEST(MapTest, InsertMany_EmptyCall) {
   // Убедиться, что размер map равен 0
   EXPECT_EQ(my_map.size(), 0);
 }
+
+TEST(MapTest, ReserveAndClearStrings) {
+  map<std::string, std::string> a;
+  a.reserve(64);
+  for (int i = 0; i < 100; ++i) {
+    a.insert(std::to_string(i), std::string(40, 'a' + i % 26));
+  }
+  EXPECT_EQ(a.size(), 100);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.insert("key", "value");
+  map<std::string, std::string> b(a);
+  EXPECT_EQ(b.at("key"), "value");
+  EXPECT_EQ(b.size(), 1);
+}
+
+namespace {
+struct Counted {
+  static int constructed;
+  int value;
+  explicit Counted(int v = 0) : value(v) { ++constructed; }
+  Counted(const Counted &other) : value(other.value) { ++constructed; }
+  Counted &operator=(const Counted &other) = default;
+};
+int Counted::constructed = 0;
+}  // namespace
+
+TEST(MapTest, TryEmplace) {
+  map<int, Counted> a;
+  Counted::constructed = 0;
+  auto first = a.try_emplace(1, 10);
+  EXPECT_TRUE(first.second);
+  EXPECT_EQ((*first.first).second.value, 10);
+  EXPECT_EQ(Counted::constructed, 1);
+  auto second = a.try_emplace(1, 20);
+  EXPECT_FALSE(second.second);
+  EXPECT_EQ((*second.first).second.value, 10);
+  EXPECT_EQ(Counted::constructed, 1);
+  auto third = a.emplace(std::make_pair(2, Counted(30)));
+  EXPECT_TRUE(third.second);
+  EXPECT_EQ(a.at(2).value, 30);
+  a.emplace_hint(a.end(), 3, Counted(40));
+  EXPECT_EQ(a.size(), 3);
+
+  map<std::string, std::string> b;
+  std::string key = "key";
+  b.try_emplace(std::move(key), 3, 'v');
+  EXPECT_EQ(b.at("key"), "vvv");
+  EXPECT_FALSE(b.try_emplace("key", "other").second);
+  EXPECT_TRUE(b.insert("second", std::string("value")).second);
+  EXPECT_EQ(b.at("second"), "value");
+}
+
+TEST(MapTest, KeyOnlyLookups) {
+  map<int, Counted> a;
+  a.try_emplace(1, 10);
+  a.insert_or_assign(2, Counted(20));
+  a.insert_or_assign(1, Counted(11));
+  EXPECT_EQ(a.size(), 2);
+  Counted::constructed = 0;
+  EXPECT_EQ(a.at(1).value, 11);
+  EXPECT_TRUE(a.contains(2));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_TRUE(a.find(3) == a.end());
+  EXPECT_EQ((*a.find(2)).second.value, 20);
+  EXPECT_THROW(a.at(3), std::out_of_range);
+  const map<int, Counted> &c = a;
+  EXPECT_EQ(c.at(2).value, 20);
+  EXPECT_EQ(a[1].value, 11);
+  EXPECT_EQ(Counted::constructed, 0);
+  a[5].value = 50;
+  EXPECT_EQ(Counted::constructed, 1);
+  EXPECT_EQ(a[5].value, 50);
+  EXPECT_EQ(Counted::constructed, 1);
+
+  map<int, int> empty;
+  EXPECT_FALSE(empty.contains(0));
+  EXPECT_THROW(empty.at(0), std::out_of_range);
+}
+
+TEST(MapTest, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> a;
+  a["one"] = 1;
+  a["two"] = 2;
+  std::string_view view = "two";
+  EXPECT_TRUE(a.contains(view));
+  EXPECT_FALSE(a.contains("three"));
+  EXPECT_EQ(a.count("one"), 1);
+  EXPECT_EQ((*a.find(view)).second, 2);
+  EXPECT_TRUE(a.find(std::string_view("zero")) == a.end());
+
+  s21::map<int, int, std::greater<int>> b{{1, 10}, {3, 30}, {2, 20}};
+  EXPECT_EQ((*b.begin()).first, 3);
+  EXPECT_EQ(b.at(2), 20);
+}
+
+TEST(MapTest, Bounds) {
+  map<int, int> a{{10, 1}, {20, 2}, {30, 3}};
+  EXPECT_EQ((*a.lower_bound(20)).second, 2);
+  EXPECT_EQ((*a.upper_bound(20)).second, 3);
+  EXPECT_TRUE(a.upper_bound(30) == a.end());
+  auto range = a.equal_range(25);
+  EXPECT_TRUE(range.first == range.second);
+  s21::map<std::string, int, std::less<>> b{{"a", 1}, {"c", 3}};
+  EXPECT_EQ((*b.lower_bound(std::string_view("b"))).second, 3);
+}
+
+TEST(MapTest, FromSorted) {
+  std::vector<std::pair<std::string, int>> items{
+      {"a", 1}, {"b", 2}, {"b", 3}, {"c", 4}, {"d", 5}};
+  auto a = map<std::string, int>::from_sorted(items.begin(), items.end());
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(a.at("b"), 2);
+  EXPECT_EQ(a.at("d"), 5);
+  a["e"] = 6;
+  EXPECT_EQ((*--a.end()).first, "e");
+}
+
+TEST(MapTest, MergeLeavesDuplicates) {
+  map<std::string, int> a{{"a", 1}, {"b", 2}};
+  map<std::string, int> b{{"b", 20}, {"c", 30}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at("b"), 2);
+  EXPECT_EQ(a.at("c"), 30);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(b.at("b"), 20);
+}
+
+TEST(MapTest, HintedInsert) {
+  map<int, std::string> a;
+  auto last = a.end();
+  for (int i = 0; i < 100; ++i) {
+    last = a.try_emplace(last, i, 2, 'x');
+  }
+  EXPECT_EQ(a.size(), 100);
+  EXPECT_EQ(a.at(99), "xx");
+  auto it = a.insert(a.begin(), {50, "other"});
+  EXPECT_EQ((*it).second, "xx");
+  a.emplace_hint(a.begin(), -1, "first");
+  EXPECT_EQ((*a.begin()).second, "first");
+  EXPECT_EQ(a.size(), 101);
+}
@@ -0,0 +1,140 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "tests_init.h"
+
+TEST(mpmc_queue, pushPop) {
+  s21::mpmc_queue<std::string> queue(4);
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.try_push("a"));
+  EXPECT_TRUE(queue.try_push(std::string("b")));
+  EXPECT_TRUE(queue.try_emplace(2, 'c'));
+  EXPECT_TRUE(queue.try_push("d"));
+  EXPECT_FALSE(queue.try_push("e"));
+  EXPECT_EQ(queue.size(), 4U);
+
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "a");
+  EXPECT_TRUE(queue.try_push("e"));
+  for (const char *expected : {"b", "cc", "d", "e"}) {
+    queue.pop(value);
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+namespace {
+struct ThrowingCopy {
+  int value;
+  bool fail;
+  ThrowingCopy(int v, bool f) : value(v), fail(f) {}
+  ThrowingCopy(const ThrowingCopy &other)
+      : value(other.value), fail(other.fail) {
+    if (fail) {
+      throw std::runtime_error("copy failed");
+    }
+  }
+  ThrowingCopy(ThrowingCopy &&other) noexcept = default;
+  ThrowingCopy &operator=(ThrowingCopy &&other) noexcept = default;
+};
+}  // namespace
+
+TEST(mpmc_queue, throwingConstructorKeepsQueueUsable) {
+  s21::mpmc_queue<ThrowingCopy> queue(2);
+  ThrowingCopy bad(1, true);
+  ThrowingCopy good(2, false);
+  EXPECT_THROW(queue.try_push(bad), std::runtime_error);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.try_push(good));
+  EXPECT_TRUE(queue.try_push(good));
+  EXPECT_FALSE(queue.try_push(good));
+
+  ThrowingCopy value(0, false);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value.value, 2);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+namespace {
+struct RejectingTarget {
+  int value;
+  bool reject;
+  RejectingTarget(int v, bool r) : value(v), reject(r) {}
+  RejectingTarget(RejectingTarget &&other) noexcept = default;
+  RejectingTarget &operator=(RejectingTarget &&other) {
+    if (reject) {
+      throw std::runtime_error("assignment failed");
+    }
+    value = other.value;
+    return *this;
+  }
+};
+}  // namespace
+
+TEST(mpmc_queue, throwingAssignmentFreesCell) {
+  s21::mpmc_queue<RejectingTarget> queue(2);
+  EXPECT_TRUE(queue.try_emplace(1, false));
+  RejectingTarget rejecting(0, true);
+  EXPECT_THROW(queue.try_pop(rejecting), std::runtime_error);
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.try_emplace(2, false));
+  EXPECT_TRUE(queue.try_emplace(3, false));
+  RejectingTarget value(0, false);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value.value, 2);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value.value, 3);
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(mpmc_queue, leftoversDestroyed) {
+  s21::mpmc_queue<std::string> queue(16);
+  for (int i = 0; i < 10; ++i) {
+    queue.push(std::string(100, 'x'));
+  }
+}
+
+TEST(mpmc_queue, manyThreads) {
+  const int kThreads = 4;
+  const long kPerProducer = 100000;
+  s21::mpmc_queue<long> queue(256);
+  std::atomic<long> sum{0};
+  std::atomic<long> popped{0};
+
+  std::thread producers[kThreads];
+  std::thread consumers[kThreads];
+  for (int t = 0; t < kThreads; ++t) {
+    producers[t] = std::thread([&queue, t, kPerProducer]() {
+      for (long i = 0; i < kPerProducer; ++i) {
+        queue.push(t * kPerProducer + i);
+      }
+    });
+    consumers[t] = std::thread([&queue, &sum, &popped, kPerProducer]() {
+      long local = 0;
+      for (long i = 0; i < kPerProducer; ++i) {
+        long value;
+        queue.pop(value);
+        local += value;
+      }
+      sum += local;
+      popped += kPerProducer;
+    });
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    producers[t].join();
+    consumers[t].join();
+  }
+
+  long total = kThreads * kPerProducer;
+  EXPECT_EQ(popped.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,76 @@
+#include <thread>
+#include <vector>
+
+#include "tests_init.h"
+
+namespace {
+
+struct Message : s21::mpsc_queue_hook {
+  int producer = 0;
+  int value = 0;
+};
+
+}  // namespace
+
+TEST(mpsc_queue, fifo) {
+  s21::mpsc_queue<Message> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pop(), nullptr);
+
+  Message messages[5];
+  for (int i = 0; i < 5; ++i) {
+    messages[i].value = i;
+    queue.push(&messages[i]);
+  }
+  EXPECT_FALSE(queue.empty());
+  EXPECT_EQ(queue.pop(), &messages[0]);
+
+  int expected = 1;
+  size_t drained = queue.drain(
+      [&expected](Message *message) { EXPECT_EQ(message->value, expected++); },
+      2);
+  EXPECT_EQ(drained, 2U);
+  EXPECT_EQ(queue.drain([](Message *) {}), 2U);
+  EXPECT_TRUE(queue.empty());
+
+  // узел можно класть повторно после извлечения
+  queue.push(&messages[0]);
+  EXPECT_EQ(queue.pop(), &messages[0]);
+  EXPECT_EQ(queue.pop(), nullptr);
+}
+
+TEST(mpsc_queue, manyProducers) {
+  const int kProducers = 4;
+  const int kPerProducer = 100000;
+  s21::mpsc_queue<Message> queue;
+  std::vector<Message> messages(kProducers * kPerProducer);
+
+  std::thread producers[kProducers];
+  for (int p = 0; p < kProducers; ++p) {
+    producers[p] = std::thread([&queue, &messages, p, kPerProducer]() {
+      for (int i = 0; i < kPerProducer; ++i) {
+        Message &message = messages[p * kPerProducer + i];
+        message.producer = p;
+        message.value = i;
+        queue.push(&message);
+      }
+    });
+  }
+
+  // сообщения одного производителя приходят в порядке отправки
+  int next[kProducers] = {};
+  int received = 0;
+  while (received < kProducers * kPerProducer) {
+    received += static_cast<int>(queue.drain([&next](Message *message) {
+      EXPECT_EQ(message->value, next[message->producer]);
+      next[message->producer] = message->value + 1;
+    }));
+  }
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(queue.pop(), nullptr);
+  for (int p = 0; p < kProducers; ++p) {
+    EXPECT_EQ(next[p], kPerProducer);
+  }
+}
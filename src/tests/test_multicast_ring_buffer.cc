@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <thread>
+
+#include "tests_init.h"
+
+TEST(multicast_ring_buffer, dependencies) {
+  s21::multicast_ring_buffer<int> ring(3);
+  EXPECT_EQ(ring.capacity(), 4U);
+  auto first = ring.add_consumer();
+  auto second = ring.add_consumer({first});
+  EXPECT_THROW(ring.add_consumer({7}), std::out_of_range);
+  EXPECT_EQ(ring.consumers(), 2U);
+
+  EXPECT_EQ(ring.cursor(), -1);
+  long start = ring.claim(3);
+  EXPECT_EQ(start, 0);
+  for (long i = start; i < start + 3; ++i) {
+    ring[i] = static_cast<int>(i * 10);
+  }
+  EXPECT_EQ(ring.try_available(first), -1);
+  ring.publish(start + 2);
+  EXPECT_EQ(ring.try_available(first), 2);
+  EXPECT_EQ(ring.try_available(second), -1);
+
+  // второй потребитель видит только то, что отпустил первый
+  EXPECT_EQ(ring.wait_for(first, 0), 2);
+  EXPECT_EQ(ring[1], 10);
+  ring.release(first, 1);
+  EXPECT_EQ(ring.wait_for(second, 0), 1);
+
+  // место освобождает только последняя стадия
+  long next = 0;
+  EXPECT_TRUE(ring.try_claim(1, next));
+  EXPECT_EQ(next, 3);
+  EXPECT_FALSE(ring.try_claim(1, next));
+  ring.release(first, 2);
+  EXPECT_FALSE(ring.try_claim(1, next));
+  ring.release(second, 0);
+  EXPECT_TRUE(ring.try_claim(1, next));
+  EXPECT_EQ(next, 4);
+  ring.publish(4);
+  EXPECT_EQ(ring.wait_for(first, 3), 4);
+}
+
+namespace {
+
+struct Event {
+  long value = 0;
+  long doubled = 0;
+};
+
+}  // namespace
+
+TEST(multicast_ring_buffer, pipeline) {
+  const long kEvents = 200000;
+  const size_t kBatch = 16;
+  s21::multicast_ring_buffer<Event> ring(256);
+  // doubler и summer читают каждое событие параллельно, checker идет за
+  // обоими и видит поле, записанное doubler
+  auto doubler = ring.add_consumer();
+  auto summer = ring.add_consumer();
+  auto checker = ring.add_consumer({doubler, summer});
+
+  long sum = 0;
+  long checked = 0;
+  auto consume = [&ring](size_t consumer, auto handle) {
+    long next = 0;
+    while (next < kEvents) {
+      long available = ring.wait_for(consumer, next);
+      for (; next <= available; ++next) {
+        handle(ring[next]);
+      }
+      ring.release(consumer, available);
+    }
+  };
+
+  std::thread threads[] = {
+      std::thread([&]() {
+        consume(doubler, [](Event &event) { event.doubled = event.value * 2; });
+      }),
+      std::thread([&]() {
+        consume(summer, [&sum](const Event &event) { sum += event.value; });
+      }),
+      std::thread([&]() {
+        consume(checker, [&checked](const Event &event) {
+          if (event.doubled == event.value * 2) {
+            ++checked;
+          }
+        });
+      })};
+
+  for (long produced = 0; produced < kEvents;) {
+    size_t count = static_cast<size_t>(
+        std::min<long>(static_cast<long>(kBatch), kEvents - produced));
+    long first = ring.claim(count);
+    for (size_t i = 0; i < count; ++i) {
+      ring[first + static_cast<long>(i)].value = produced + 1;
+      ring[first + static_cast<long>(i)].doubled = 0;
+      ++produced;
+    }
+    ring.publish(first + static_cast<long>(count) - 1);
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(sum, kEvents * (kEvents + 1) / 2);
+  EXPECT_EQ(checked, kEvents);
+}
@@ -1,6 +1,9 @@
 
 
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "tests_init.h"
 
@@ -200,12 +203,7 @@ TEST(method_multiset, lower_bound) {
       },
       std::out_of_range);
 
-  EXPECT_THROW(
-      {
-        auto it = a.lower_bound(0);
-        *it;
-      },
-      std::out_of_range);
+  EXPECT_EQ(*a.lower_bound(0), *c.lower_bound(0));
 }
 
 TEST(method_multiset, lower_bound2) {
@@ -232,19 +230,8 @@ TEST(method_multiset, upper_bound) {
       },
       std::out_of_range);
 
-  EXPECT_THROW(
-      {
-        auto it = a.upper_bound(0);
-        *it;
-      },
-      std::out_of_range);
-
-  EXPECT_THROW(
-      {
-        auto it = a.upper_bound(-1);
-        *it;
-      },
-      std::out_of_range);
+  EXPECT_EQ(*a.upper_bound(0), *c.upper_bound(0));
+  EXPECT_EQ(*a.upper_bound(-1), *c.upper_bound(-1));
 }
 
 TEST(method_multiset, upper_bound2) {
@@ -466,3 +453,117 @@ TEST(MultiSetTest, InsertMany_EmptyCall) {
   // Убедиться, что размер мультимножества равен 0
   EXPECT_EQ(my_multiset.size(), 0);
 }
+
+TEST(MultiSetTest, Emplace) {
+  s21::multiset<std::pair<int, int>> a;
+  a.emplace(1, 2);
+  a.emplace(1, 2);
+  a.emplace_hint(a.begin(), 0, 1);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ((*a.begin()).first, 0);
+  s21::multiset<double> b;
+  b.insert_many(1.5, 1.5, 0.5);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(*b.begin(), 0.5);
+}
+
+TEST(MultiSetTest, CustomCompare) {
+  s21::multiset<int, std::greater<int>> a{1, 3, 3, 2};
+  std::multiset<int, std::greater<int>> b{1, 3, 3, 2};
+  auto it = a.begin();
+  for (int value : b) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  s21::multiset<std::string, std::less<>> c{"a", "b", "b"};
+  EXPECT_TRUE(c.contains(std::string_view("b")));
+  EXPECT_FALSE(c.contains("c"));
+}
+
+TEST(MultiSetTest, BoundsMatchStd) {
+  s21::multiset<int> a;
+  std::multiset<int> b;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 37) % 101;
+    a.insert(key);
+    b.insert(key);
+  }
+  for (int key = -2; key < 104; ++key) {
+    auto lower = b.lower_bound(key);
+    auto upper = b.upper_bound(key);
+    if (lower == b.end()) {
+      EXPECT_TRUE(a.lower_bound(key) == a.end());
+    } else {
+      EXPECT_EQ(*a.lower_bound(key), *lower);
+    }
+    if (upper == b.end()) {
+      EXPECT_TRUE(a.upper_bound(key) == a.end());
+    } else {
+      EXPECT_EQ(*a.upper_bound(key), *upper);
+    }
+    EXPECT_EQ(a.count(key), b.count(key));
+    auto range = a.equal_range(key);
+    size_t in_range = 0;
+    for (auto it = range.first; it != range.second; ++it) ++in_range;
+    EXPECT_EQ(in_range, b.count(key));
+  }
+  s21::multiset<int> single{5};
+  EXPECT_EQ(single.count(5), 1);
+  EXPECT_TRUE(single.upper_bound(5) == single.end());
+  s21::multiset<int> empty;
+  EXPECT_EQ(empty.count(0), 0);
+  EXPECT_TRUE(empty.lower_bound(0) == empty.end());
+}
+
+TEST(MultiSetTest, BoundsWithComparator) {
+  s21::multiset<int, std::greater<int>> a{5, 3, 3, 1};
+  EXPECT_EQ(*a.lower_bound(3), 3);
+  EXPECT_EQ(*a.upper_bound(3), 1);
+  EXPECT_EQ(a.count(3), 2);
+  s21::multiset<std::string, std::less<>> b{"a", "b", "b", "c"};
+  EXPECT_EQ(b.count(std::string_view("b")), 2);
+  EXPECT_EQ(*b.upper_bound("b"), "c");
+}
+
+TEST(MultiSetTest, FromSorted) {
+  std::vector<int> keys{1, 1, 2, 3, 3, 3, 4};
+  auto a = s21::multiset<int>::from_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(a.size(), keys.size());
+  EXPECT_EQ(a.count(3), 3);
+  EXPECT_EQ(a.count(1), 2);
+  s21::multiset<int> b{1, 2, 2, 5};
+  EXPECT_EQ(b.count(2), 2);
+  b.insert(2);
+  EXPECT_EQ(b.count(2), 3);
+}
+
+TEST(MultiSetTest, MergeKeepsAllElements) {
+  s21::multiset<std::string> a{"b", "d", "d"};
+  s21::multiset<std::string> b{"a", "d", "e"};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 6);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.count("d"), 3);
+  EXPECT_EQ(*a.begin(), "a");
+  b.insert("z");
+  EXPECT_EQ(b.size(), 1);
+}
+
+TEST(MultiSetTest, HintedInsert) {
+  s21::multiset<int> a;
+  std::multiset<int> b;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 7) % 50;
+    a.insert(a.lower_bound(key), key);
+    a.emplace_hint(a.end(), key);
+    b.insert(key);
+    b.insert(key);
+  }
+  ASSERT_EQ(a.size(), b.size());
+  auto it = a.begin();
+  for (int key : b) {
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  EXPECT_EQ(a.count(7), b.count(7));
+}
@@ -0,0 +1,135 @@
+#include <functional>
+#include <queue>
+#include <string>
+
+#include "tests_init.h"
+
+TEST(priority_queue, pushPop) {
+  s21::priority_queue<int> s21_queue;
+  std::priority_queue<int> std_queue;
+  EXPECT_TRUE(s21_queue.empty());
+
+  for (int i = 0; i < 1000; ++i) {
+    int value = rand() % 500;
+    s21_queue.push(value);
+    std_queue.push(value);
+    if (i % 3 == 0) {
+      s21_queue.pop();
+      std_queue.pop();
+    }
+    ASSERT_EQ(s21_queue.size(), std_queue.size());
+    if (!std_queue.empty()) {
+      EXPECT_EQ(s21_queue.top(), std_queue.top());
+    }
+  }
+  while (!std_queue.empty()) {
+    EXPECT_EQ(s21_queue.top(), std_queue.top());
+    s21_queue.pop();
+    std_queue.pop();
+  }
+  EXPECT_TRUE(s21_queue.empty());
+}
+
+TEST(priority_queue, heapifyRange) {
+  int values[] = {5, 1, 9, 3, 7, 2, 8, 6, 4, 0, 11, 10};
+  s21::priority_queue<int, std::greater<int>, 3> s21_queue(
+      values, values + sizeof(values) / sizeof(values[0]));
+  for (int expected = 0; expected < 12; ++expected) {
+    EXPECT_EQ(s21_queue.top(), expected);
+    s21_queue.pop();
+  }
+  EXPECT_TRUE(s21_queue.empty());
+}
+
+TEST(priority_queue, initializerListAndSwap) {
+  s21::priority_queue<std::string> first = {"b", "d", "a"};
+  s21::priority_queue<std::string> second;
+  second.insert_many(std::string("x"), std::string("y"));
+
+  first.swap(second);
+  EXPECT_EQ(first.top(), "y");
+  EXPECT_EQ(first.size(), 2U);
+  EXPECT_EQ(second.top(), "d");
+  EXPECT_EQ(second.size(), 3U);
+}
+
+TEST(indexed_priority_queue, decreaseKey) {
+  s21::indexed_priority_queue<int, std::greater<int>> queue;
+  auto a = queue.push(50);
+  auto b = queue.push(40);
+  auto c = queue.push(30);
+
+  EXPECT_EQ(queue.top_handle(), c);
+  queue.decrease_key(a, 10);
+  EXPECT_EQ(queue.top_handle(), a);
+  EXPECT_EQ(queue.top(), 10);
+  EXPECT_EQ(queue.value(b), 40);
+
+  queue.update(a, 45);
+  EXPECT_EQ(queue.top_handle(), c);
+  queue.pop();
+  EXPECT_FALSE(queue.contains(c));
+  EXPECT_EQ(queue.top_handle(), b);
+  queue.pop();
+  EXPECT_EQ(queue.top_handle(), a);
+  EXPECT_EQ(queue.size(), 1U);
+}
+
+TEST(indexed_priority_queue, eraseAndReuse) {
+  s21::indexed_priority_queue<int> queue;
+  s21::vector<size_t> handles;
+  for (int i = 0; i < 100; ++i) {
+    handles.push_back(queue.push(i));
+  }
+  for (int i = 0; i < 100; i += 2) {
+    queue.erase(handles[i]);
+  }
+  EXPECT_EQ(queue.size(), 50U);
+  EXPECT_FALSE(queue.contains(handles[10]));
+  EXPECT_TRUE(queue.contains(handles[11]));
+
+  auto reused = queue.push(1000);
+  EXPECT_LT(reused, 100U);
+  EXPECT_EQ(queue.top_handle(), reused);
+  queue.pop();
+
+  for (int expected = 99; expected > 0; expected -= 2) {
+    EXPECT_EQ(queue.top(), expected);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(indexed_priority_queue, dijkstra) {
+  const int kVertices = 6;
+  const int kInf = 1000000;
+  int weight[kVertices][kVertices] = {
+      {0, 7, 9, 0, 0, 14}, {7, 0, 10, 15, 0, 0}, {9, 10, 0, 11, 0, 2},
+      {0, 15, 11, 0, 6, 0}, {0, 0, 0, 6, 0, 9},  {14, 0, 2, 0, 9, 0}};
+
+  s21::indexed_priority_queue<std::pair<int, int>,
+                              std::greater<std::pair<int, int>>>
+      queue;
+  size_t handle[kVertices];
+  int dist[kVertices];
+  for (int v = 0; v < kVertices; ++v) {
+    dist[v] = v == 0 ? 0 : kInf;
+    handle[v] = queue.push({dist[v], v});
+  }
+  while (!queue.empty()) {
+    int u = queue.top().second;
+    queue.pop();
+    for (int v = 0; v < kVertices; ++v) {
+      if (weight[u][v] != 0 && queue.contains(handle[v]) &&
+          dist[u] + weight[u][v] < dist[v]) {
+        dist[v] = dist[u] + weight[u][v];
+        queue.decrease_key(handle[v], {dist[v], v});
+      }
+    }
+  }
+
+  int expected[kVertices] = {0, 7, 9, 20, 20, 11};
+  for (int v = 0; v < kVertices; ++v) {
+    EXPECT_EQ(dist[v], expected[v]);
+  }
+}
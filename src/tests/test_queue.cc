@@ -1,4 +1,7 @@
+#include <deque>
+#include <memory>
 #include <queue>
+#include <string>
 
 #include "tests_init.h"
 
@@ -136,4 +139,137 @@ TEST(queue, insertManyBack) {
     s21_queue.pop();
     std_queue.pop();
   }
-}
\ No newline at end of file
+}
+
+TEST(queue, reserveShrink) {
+  s21::queue<int> s21_queue;
+  std::queue<int> std_queue;
+  s21_queue.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    s21_queue.push(i);
+    std_queue.push(i);
+  }
+  for (int i = 0; i < 990; ++i) {
+    s21_queue.pop();
+    std_queue.pop();
+  }
+  s21_queue.shrink_to_fit();
+
+  EXPECT_EQ(s21_queue.size(), std_queue.size());
+  while (!s21_queue.empty()) {
+    EXPECT_EQ(s21_queue.front(), std_queue.front());
+    EXPECT_EQ(s21_queue.back(), std_queue.back());
+    s21_queue.pop();
+    std_queue.pop();
+  }
+}
+
+TEST(queue, selfReferencingPushWhenFull) {
+  s21::queue<std::string> s21_queue;
+  std::queue<std::string> std_queue;
+  for (int i = 0; i < 8; ++i) {
+    std::string value(32, static_cast<char>('a' + i));
+    s21_queue.push(value);
+    std_queue.push(value);
+  }
+  s21_queue.push(s21_queue.front());
+  std_queue.push(std_queue.front());
+  s21_queue.push(s21_queue.back());
+  std_queue.push(std_queue.back());
+
+  EXPECT_EQ(s21_queue.size(), std_queue.size());
+  while (!s21_queue.empty()) {
+    EXPECT_EQ(s21_queue.front(), std_queue.front());
+    s21_queue.pop();
+    std_queue.pop();
+  }
+}
+
+TEST(queue, ringBufferSelfReferencingPushFront) {
+  s21::ring_buffer<std::string> ring;
+  std::deque<std::string> expected;
+  for (int i = 0; i < 8; ++i) {
+    std::string value(32, static_cast<char>('a' + i));
+    ring.push_back(value);
+    expected.push_back(value);
+  }
+  ring.push_front(ring.back());
+  expected.push_front(expected.back());
+  for (int i = 0; i < 7; ++i) {
+    ring.push_back(std::string(32, 'x'));
+    expected.push_back(std::string(32, 'x'));
+  }
+  ring.push_front(ring.front());
+  expected.push_front(expected.front());
+
+  ASSERT_EQ(ring.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(ring[i], expected[i]);
+  }
+}
+
+TEST(queue, listContainer) {
+  s21::queue<int, s21::list<int>> s21_queue = {1, 2, 3};
+  std::queue<int> std_queue({1, 2, 3});
+
+  s21_queue.insert_many_back(4, 5);
+  std_queue.push(4);
+  std_queue.push(5);
+  s21_queue.pop();
+  std_queue.pop();
+
+  EXPECT_EQ(s21_queue.size(), std_queue.size());
+  while (!s21_queue.empty()) {
+    EXPECT_EQ(s21_queue.front(), std_queue.front());
+    EXPECT_EQ(s21_queue.back(), std_queue.back());
+    s21_queue.pop();
+    std_queue.pop();
+  }
+}
+
+TEST(queue, dequeContainer) {
+  s21::queue<std::string, s21::deque<std::string>> s21_queue = {"a", "b"};
+  std::queue<std::string> std_queue({"a", "b"});
+
+  for (int i = 0; i < 300; ++i) {
+    s21_queue.push(std::to_string(i));
+    std_queue.push(std::to_string(i));
+    s21_queue.pop();
+    std_queue.pop();
+  }
+  EXPECT_EQ(s21_queue.size(), std_queue.size());
+  EXPECT_EQ(s21_queue.front(), std_queue.front());
+  EXPECT_EQ(s21_queue.back(), std_queue.back());
+}
+
+TEST(queue, moveOnly) {
+  s21::queue<std::unique_ptr<int>> s21_queue;
+  s21_queue.push(std::make_unique<int>(1));
+  s21_queue.emplace(new int(2));
+  s21_queue.insert_many_back(std::make_unique<int>(3));
+  EXPECT_EQ(*s21_queue.back(), 3);
+
+  std::unique_ptr<int> value = s21_queue.pop_value();
+  EXPECT_EQ(*value, 1);
+  EXPECT_TRUE(s21_queue.try_pop(value));
+  EXPECT_EQ(*value, 2);
+  EXPECT_TRUE(s21_queue.try_pop(value));
+  EXPECT_EQ(*value, 3);
+  EXPECT_FALSE(s21_queue.try_pop(value));
+  EXPECT_EQ(*value, 3);
+}
+
+TEST(queue, moveOnlyOtherContainers) {
+  s21::queue<std::unique_ptr<int>, s21::list<std::unique_ptr<int>>> listed;
+  s21::queue<std::unique_ptr<int>, s21::deque<std::unique_ptr<int>>> chunked;
+  for (int i = 0; i < 5; ++i) {
+    listed.emplace(new int(i));
+    chunked.push(std::make_unique<int>(i));
+  }
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(*listed.pop_value(), i);
+    EXPECT_EQ(*chunked.pop_value(), i);
+  }
+  EXPECT_TRUE(listed.empty());
+  EXPECT_TRUE(chunked.empty());
+}
@@ -0,0 +1,128 @@
+#include <deque>
+#include <string>
+
+#include "tests_init.h"
+
+template <typename T>
+static void ExpectEqualBuffers(const s21::ring_buffer<T> &buffer,
+                               const std::deque<T> &expected) {
+  ASSERT_EQ(buffer.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(buffer[i], expected[i]);
+  }
+}
+
+TEST(ring_buffer, constructors) {
+  s21::ring_buffer<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.capacity(), 0U);
+
+  s21::ring_buffer<int> reserved(10);
+  EXPECT_TRUE(reserved.empty());
+  EXPECT_EQ(reserved.capacity(), 16U);
+
+  s21::ring_buffer<int> items = {1, 2, 3};
+  ExpectEqualBuffers(items, {1, 2, 3});
+
+  s21::ring_buffer<int> copy(items);
+  ExpectEqualBuffers(copy, {1, 2, 3});
+
+  s21::ring_buffer<int> moved(std::move(copy));
+  ExpectEqualBuffers(moved, {1, 2, 3});
+  EXPECT_TRUE(copy.empty());
+
+  s21::ring_buffer<int> assigned;
+  assigned = items;
+  ExpectEqualBuffers(assigned, {1, 2, 3});
+  assigned = s21::ring_buffer<int>{4, 5};
+  ExpectEqualBuffers(assigned, {4, 5});
+}
+
+TEST(ring_buffer, wrapAroundAndGrowth) {
+  s21::ring_buffer<int> buffer;
+  std::deque<int> expected;
+  for (int i = 0; i < 6; ++i) {
+    buffer.push_back(i);
+    expected.push_back(i);
+  }
+  for (int i = 0; i < 4; ++i) {
+    buffer.pop_front();
+    expected.pop_front();
+  }
+  for (int i = 6; i < 12; ++i) {
+    buffer.push_back(i);
+    expected.push_back(i);
+  }
+  EXPECT_EQ(buffer.capacity(), 8U);
+  ExpectEqualBuffers(buffer, expected);
+
+  for (int i = 12; i < 40; ++i) {
+    buffer.push_back(i);
+    expected.push_back(i);
+  }
+  EXPECT_EQ(buffer.capacity(), 64U);
+  ExpectEqualBuffers(buffer, expected);
+  EXPECT_EQ(buffer.front(), expected.front());
+  EXPECT_EQ(buffer.back(), expected.back());
+}
+
+TEST(ring_buffer, bothEnds) {
+  s21::ring_buffer<std::string> buffer;
+  std::deque<std::string> expected;
+  for (int i = 0; i < 1000; ++i) {
+    std::string value = std::to_string(rand() % 100);
+    switch (rand() % 4) {
+      case 0:
+        buffer.push_back(value);
+        expected.push_back(value);
+        break;
+      case 1:
+        buffer.push_front(value);
+        expected.push_front(value);
+        break;
+      case 2:
+        if (!expected.empty()) {
+          buffer.pop_front();
+          expected.pop_front();
+        }
+        break;
+      default:
+        if (!expected.empty()) {
+          buffer.pop_back();
+          expected.pop_back();
+        }
+    }
+    ASSERT_EQ(buffer.size(), expected.size());
+    if (!expected.empty()) {
+      EXPECT_EQ(buffer.front(), expected.front());
+      EXPECT_EQ(buffer.back(), expected.back());
+    }
+  }
+  ExpectEqualBuffers(buffer, expected);
+}
+
+TEST(ring_buffer, reserveShrink) {
+  s21::ring_buffer<int> buffer;
+  buffer.reserve(100);
+  EXPECT_EQ(buffer.capacity(), 128U);
+  for (int i = 0; i < 20; ++i) {
+    buffer.push_back(i);
+  }
+  buffer.pop_front();
+  buffer.shrink_to_fit();
+  EXPECT_EQ(buffer.capacity(), 32U);
+  EXPECT_EQ(buffer.front(), 1);
+  EXPECT_EQ(buffer.back(), 19);
+
+  buffer.clear();
+  buffer.shrink_to_fit();
+  EXPECT_EQ(buffer.capacity(), 0U);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_THROW(buffer.at(0), std::out_of_range);
+}
+
+TEST(ring_buffer, insertManyBack) {
+  s21::ring_buffer<int> buffer = {1};
+  buffer.insert_many_back(2, 3, 4);
+  ExpectEqualBuffers(buffer, {1, 2, 3, 4});
+}
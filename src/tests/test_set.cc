@@ -2,6 +2,9 @@
 
 #include <climits>
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "tests_init.h"
 
@@ -304,6 +307,62 @@ TEST(edge_case, large_number_of_elements) {
   EXPECT_TRUE(a.empty());
 }
 
+namespace {
+// черная высота поддерева или -1, если нарушено свойство красно-черного
+// дерева или связь с родителем
+template <typename Tree, typename Node>
+int CheckedBlackHeight(const Node *node) {
+  if (node == nullptr) return 1;
+  if (node->colour_ == Tree::Red &&
+      ((node->left_ != nullptr && node->left_->colour_ == Tree::Red) ||
+       (node->right_ != nullptr && node->right_->colour_ == Tree::Red))) {
+    return -1;
+  }
+  if ((node->left_ != nullptr && node->left_->parent_ != node) ||
+      (node->right_ != nullptr && node->right_->parent_ != node)) {
+    return -1;
+  }
+  int left = CheckedBlackHeight<Tree>(node->left_);
+  int right = CheckedBlackHeight<Tree>(node->right_);
+  if (left < 0 || left != right) return -1;
+  return left + (node->colour_ == Tree::Black ? 1 : 0);
+}
+
+template <typename Tree>
+bool IsRedBlack(Tree &tree) {
+  if (tree.empty()) return true;
+  auto *root = tree.begin().current_;
+  while (root->parent_ != nullptr) root = root->parent_;
+  return root->colour_ == Tree::Black && CheckedBlackHeight<Tree>(root) > 0;
+}
+}  // namespace
+
+// удаления в глубоком дереве поднимают двойную черноту на несколько
+// уровней вверх
+TEST(edge_case, erase_keeps_red_black_properties) {
+  const int count = 2000;
+  for (int order = 0; order < 3; ++order) {
+    s21::set<int> a;
+    std::set<int> b;
+    for (int i = 0; i < count; ++i) {
+      a.insert(i);
+      b.insert(i);
+    }
+    for (int i = 0; i < count; ++i) {
+      int key = order == 0   ? i
+                : order == 1 ? count - 1 - i
+                             : (i * 7919) % count;
+      a.erase(a.find(key));
+      b.erase(key);
+      ASSERT_TRUE(IsRedBlack(a)) << "after erasing " << key;
+      ASSERT_EQ(a.size(), b.size());
+      if (!b.empty()) {
+        ASSERT_TRUE(a.contains(*b.begin()));
+      }
+    }
+  }
+}
+
 TEST(edge_case, insert_negative_and_boundary_values) {
   s21::set<int> a;
   a.insert(-100);
@@ -455,3 +514,257 @@ TEST(SetTest, AssignmentOperator) {
     ++it2;
   }
 }
+
+TEST(SetTest, ReserveAndChurn) {
+  s21::set<int> a;
+  std::set<int> b;
+  a.reserve(1000);
+  unsigned state = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>(state >> 16) % 1000;
+    if (state & 1) {
+      EXPECT_EQ(a.insert(key).second, b.insert(key).second);
+    } else {
+      auto it = a.find(key);
+      EXPECT_EQ(it != a.end(), b.erase(key) == 1);
+      if (it != a.end()) a.erase(it);
+    }
+    EXPECT_EQ(a.size(), b.size());
+  }
+  for (int key : b) {
+    EXPECT_TRUE(a.contains(key));
+  }
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.insert(7);
+  s21::set<int> c(std::move(a));
+  c.insert(3);
+  EXPECT_EQ(*c.begin(), 3);
+  EXPECT_EQ(c.size(), 2);
+}
+
+TEST(SetTest, Emplace) {
+  s21::set<std::pair<int, int>> a;
+  auto first = a.emplace(1, 2);
+  EXPECT_TRUE(first.second);
+  EXPECT_EQ((*first.first).second, 2);
+  auto second = a.emplace(1, 2);
+  EXPECT_FALSE(second.second);
+  EXPECT_TRUE(first.first == second.first);
+  a.emplace_hint(a.begin(), 0, 5);
+  EXPECT_EQ((*a.begin()).first, 0);
+  EXPECT_EQ(a.size(), 2);
+  s21::set<std::string> b;
+  std::string word(30, 'x');
+  EXPECT_TRUE(b.insert(std::move(word)).second);
+  EXPECT_FALSE(b.insert(std::string(30, 'x')).second);
+  EXPECT_EQ(b.size(), 1);
+}
+
+TEST(SetTest, CustomCompare) {
+  s21::set<int, std::greater<int>> a{3, 1, 2};
+  std::set<int, std::greater<int>> b{3, 1, 2};
+  auto it = a.begin();
+  for (int value : b) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(a.contains(2));
+  EXPECT_EQ(a.count(4), 0);
+}
+
+TEST(SetTest, TransparentLookup) {
+  s21::set<std::string, std::less<>> a{"alpha", "beta", "gamma"};
+  std::string_view view = "beta";
+  EXPECT_TRUE(a.contains(view));
+  EXPECT_TRUE(a.contains("gamma"));
+  EXPECT_FALSE(a.contains("delta"));
+  EXPECT_EQ(a.count(view), 1);
+  EXPECT_EQ(*a.find(view), "beta");
+  EXPECT_TRUE(a.find("delta") == a.end());
+}
+
+TEST(SetTest, Bounds) {
+  s21::set<int> a{10, 20, 30};
+  EXPECT_EQ(*a.lower_bound(20), 20);
+  EXPECT_EQ(*a.upper_bound(20), 30);
+  EXPECT_EQ(*a.lower_bound(15), 20);
+  EXPECT_TRUE(a.lower_bound(31) == a.end());
+  auto range = a.equal_range(10);
+  EXPECT_EQ(*range.first, 10);
+  EXPECT_EQ(*range.second, 20);
+}
+
+TEST(SetTest, FromSorted) {
+  for (int n = 0; n < 70; ++n) {
+    std::vector<int> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(i * 2);
+    s21::set<int> a = s21::set<int>::from_sorted(keys.begin(), keys.end());
+    ASSERT_EQ(a.size(), static_cast<size_t>(n));
+    EXPECT_TRUE(IsRedBlack(a));
+    int expected = 0;
+    for (auto it = a.begin(); it != a.end() && expected < 2 * n; ++it) {
+      EXPECT_EQ(*it, expected);
+      expected += 2;
+    }
+    a.insert(-1);
+    a.insert(2 * n + 1);
+    if (n > 0) a.erase(a.find(0));
+    EXPECT_TRUE(IsRedBlack(a));
+    EXPECT_EQ(a.size(), static_cast<size_t>(n == 0 ? 2 : n + 1));
+  }
+  std::vector<int> duplicates{1, 1, 2, 3, 3, 3, 4};
+  s21::set<int> b =
+      s21::set<int>::from_sorted(duplicates.begin(), duplicates.end());
+  EXPECT_EQ(b.size(), 4);
+  EXPECT_TRUE(IsRedBlack(b));
+  s21::set<int> c{1, 2, 3, 4, 5, 6, 7, 8};
+  EXPECT_EQ(c.size(), 8);
+  EXPECT_TRUE(IsRedBlack(c));
+  EXPECT_EQ(*c.begin(), 1);
+}
+
+TEST(SetTest, MergeRelinksNodes) {
+  for (int small : {1, 3, 200}) {
+    s21::set<int> a;
+    std::set<int> b;
+    for (int i = 0; i < 300; i += 2) {
+      a.insert(i);
+      b.insert(i);
+    }
+    s21::set<int> other;
+    std::set<int> std_other;
+    for (int i = 0; i < small; ++i) {
+      other.insert(i * 3);
+      std_other.insert(i * 3);
+    }
+    int *kept = small > 1 ? &*other.find(3) : nullptr;
+    a.merge(other);
+    b.merge(std_other);
+    EXPECT_TRUE(IsRedBlack(a));
+    EXPECT_TRUE(IsRedBlack(other));
+    ASSERT_EQ(a.size(), b.size());
+    ASSERT_EQ(other.size(), std_other.size());
+    auto it = a.begin();
+    for (int key : b) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+    for (int key : std_other) {
+      EXPECT_TRUE(other.contains(key));
+    }
+    if (small > 1) {
+      EXPECT_EQ(&*a.find(3), kept);
+    }
+    other.insert(-7);
+    EXPECT_TRUE(other.contains(-7));
+  }
+  s21::set<int> empty;
+  s21::set<int> source{1, 2};
+  empty.merge(source);
+  EXPECT_EQ(empty.size(), 2);
+  EXPECT_TRUE(source.empty());
+}
+
+TEST(SetTest, SpliceKeepsReserveHonest) {
+  s21::NodePool<int> pool;
+  s21::NodePool<int> other;
+  s21::vector<int *> nodes;
+  for (int i = 0; i < 20; ++i) nodes.push_back(pool.Create(i));
+  nodes.push_back(other.Create(-1));
+  other.Reserve(100);
+  pool.Splice(other);
+  EXPECT_EQ(other.capacity(), 0);
+  pool.Reserve(150);
+  size_t capacity = pool.capacity();
+  for (int i = 0; i < 150; ++i) nodes.push_back(pool.Create(i));
+  EXPECT_EQ(pool.capacity(), capacity);
+  for (size_t i = 0; i < nodes.size(); ++i) pool.Destroy(nodes[i]);
+}
+
+TEST(SetTest, SetAlgebra) {
+  s21::set<int> a{1, 2, 3, 5, 8};
+  s21::set<int> b{2, 3, 4, 8, 9};
+  std::vector<int> expected_union{1, 2, 3, 4, 5, 8, 9};
+  std::vector<int> expected_intersection{2, 3, 8};
+  std::vector<int> expected_difference{1, 5};
+  std::vector<int> expected_symmetric{1, 4, 5, 9};
+  auto check = [](s21::set<int> result, const std::vector<int> &expected) {
+    ASSERT_EQ(result.size(), expected.size());
+    EXPECT_TRUE(IsRedBlack(result));
+    auto it = result.begin();
+    for (int key : expected) {
+      EXPECT_EQ(*it, key);
+      ++it;
+    }
+  };
+  check(s21::set_union(a, b), expected_union);
+  check(s21::set_intersection(a, b), expected_intersection);
+  check(s21::set_difference(a, b), expected_difference);
+  check(s21::set_symmetric_difference(a, b), expected_symmetric);
+  s21::set<int> empty;
+  check(s21::set_union(a, empty), {1, 2, 3, 5, 8});
+  EXPECT_TRUE(s21::set_intersection(a, empty).empty());
+  s21::set<std::string> words{"b", "a"};
+  EXPECT_EQ(s21::set_difference(words, s21::set<std::string>{"a"}).size(), 1);
+}
+
+namespace {
+struct CountingLess {
+  static int calls;
+  bool operator()(int a, int b) const {
+    ++calls;
+    return a < b;
+  }
+};
+int CountingLess::calls = 0;
+}  // namespace
+
+TEST(SetTest, HintedAppend) {
+  s21::set<int, CountingLess> a;
+  CountingLess::calls = 0;
+  for (int i = 0; i < 10000; ++i) {
+    a.insert(a.end(), i);
+  }
+  EXPECT_EQ(a.size(), 10000);
+  EXPECT_LE(CountingLess::calls, 3 * 10000);
+  EXPECT_TRUE(IsRedBlack(a));
+  s21::set<int, CountingLess> b;
+  auto last = b.end();
+  CountingLess::calls = 0;
+  for (int i = 0; i < 10000; ++i) {
+    last = b.insert(last, i);
+  }
+  EXPECT_LE(CountingLess::calls, 3 * 10000);
+  EXPECT_EQ(*last, 9999);
+}
+
+TEST(SetTest, HintedInsertMatchesStd) {
+  s21::set<int> a;
+  std::set<int> b;
+  unsigned state = 777;
+  for (int i = 0; i < 3000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>(state >> 16) % 2000;
+    int probe = static_cast<int>(state >> 8) % 2000;
+    auto hint = a.lower_bound(probe);
+    auto it = a.insert(hint, key);
+    EXPECT_EQ(*it, key);
+    b.insert(key);
+    ASSERT_EQ(a.size(), b.size());
+  }
+  EXPECT_TRUE(IsRedBlack(a));
+  auto it = a.begin();
+  for (int key : b) {
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  auto dup = a.emplace_hint(a.begin(), *b.begin());
+  EXPECT_EQ(*dup, *b.begin());
+  EXPECT_EQ(a.size(), b.size());
+  a.erase(--a.end());
+  a.insert(a.end(), 5000);
+  EXPECT_EQ(*--a.end(), 5000);
+  EXPECT_TRUE(IsRedBlack(a));
+}
@@ -0,0 +1,170 @@
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests_init.h"
+
+TEST(spsc_queue, pushPop) {
+  s21::spsc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.try_push("a"));
+  EXPECT_TRUE(queue.try_push(std::string("b")));
+  EXPECT_TRUE(queue.try_emplace(2, 'c'));
+  EXPECT_TRUE(queue.try_push("d"));
+  EXPECT_FALSE(queue.try_push("e"));
+  EXPECT_EQ(queue.size(), 4U);
+
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "a");
+  EXPECT_TRUE(queue.try_push("e"));
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "b");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "cc");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "d");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "e");
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, batch) {
+  s21::spsc_queue<int> queue(8);
+  int input[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(queue.try_push_n(input, 5), 5U);
+  EXPECT_EQ(queue.try_push_n(input + 5, 5), 3U);
+
+  int output[10] = {};
+  EXPECT_EQ(queue.try_pop_n(output, 6), 6U);
+  EXPECT_EQ(queue.try_pop_n(output + 6, 6), 2U);
+  EXPECT_EQ(queue.try_pop_n(output + 8, 6), 0U);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(output[i], i);
+  }
+}
+
+namespace {
+struct CountedCopy {
+  static int alive;
+  static int copies_left;
+  int value;
+  explicit CountedCopy(int v) : value(v) { ++alive; }
+  CountedCopy(const CountedCopy &other) : value(other.value) {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    ++alive;
+  }
+  CountedCopy &operator=(const CountedCopy &other) = default;
+  ~CountedCopy() { --alive; }
+};
+int CountedCopy::alive = 0;
+int CountedCopy::copies_left = 0;
+}  // namespace
+
+TEST(spsc_queue, batchRollsBackOnThrow) {
+  {
+    std::vector<CountedCopy> input;
+    input.reserve(5);
+    for (int i = 0; i < 5; ++i) {
+      input.emplace_back(i);
+    }
+    s21::spsc_queue<CountedCopy> queue(8);
+    CountedCopy::copies_left = 3;
+    EXPECT_THROW(queue.try_push_n(input.begin(), 5), std::runtime_error);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(CountedCopy::alive, 5);
+
+    CountedCopy::copies_left = 5;
+    EXPECT_EQ(queue.try_push_n(input.begin(), 5), 5U);
+    CountedCopy value(-1);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value.value, 0);
+  }
+  EXPECT_EQ(CountedCopy::alive, 0);
+}
+
+namespace {
+struct FailingSink {
+  static int assignments_left;
+  std::string value;
+  FailingSink &operator=(std::string &&other) {
+    if (assignments_left-- == 0) {
+      throw std::runtime_error("assignment failed");
+    }
+    value = std::move(other);
+    return *this;
+  }
+};
+int FailingSink::assignments_left = 0;
+}  // namespace
+
+TEST(spsc_queue, popBatchStopsAtThrow) {
+  s21::spsc_queue<std::string> queue(8);
+  for (int i = 0; i < 5; ++i) {
+    queue.try_push(std::string(32, static_cast<char>('a' + i)));
+  }
+  FailingSink sink[5];
+  FailingSink::assignments_left = 2;
+  EXPECT_THROW(queue.try_pop_n(sink, 5), std::runtime_error);
+  EXPECT_EQ(sink[1].value, std::string(32, 'b'));
+  EXPECT_EQ(queue.size(), 3U);
+
+  std::string value;
+  for (char expected : {'c', 'd', 'e'}) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, std::string(32, expected));
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(spsc_queue, leftoversDestroyed) {
+  s21::spsc_queue<std::string> queue(16);
+  for (int i = 0; i < 10; ++i) {
+    queue.try_push(std::string(100, 'x'));
+  }
+}
+
+TEST(spsc_queue, twoThreads) {
+  const int kCount = 1000000;
+  s21::spsc_queue<int> queue(1024);
+
+  std::thread producer([&queue]() {
+    int batch[16];
+    int next = 0;
+    while (next < kCount) {
+      if (next % 3 == 0) {
+        int size = 0;
+        for (; size < 16 && next + size < kCount; ++size) {
+          batch[size] = next + size;
+        }
+        next += queue.try_push_n(batch, size);
+      } else if (queue.try_push(next)) {
+        ++next;
+      }
+    }
+  });
+
+  int expected = 0;
+  bool ordered = true;
+  int batch[32];
+  while (expected < kCount) {
+    size_t count = queue.try_pop_n(batch, 32);
+    for (size_t i = 0; i < count; ++i) {
+      ordered = ordered && batch[i] == expected++;
+    }
+    int value;
+    if (queue.try_pop(value)) {
+      ordered = ordered && value == expected++;
+    }
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
@@ -1,3 +1,4 @@
+#include <memory>
 #include <stack>
 
 #include "tests_init.h"
@@ -225,4 +226,74 @@ TEST(stack, insertManyFront) {
   }
 }
 
+TEST(stack, forwardListContainer) {
+  s21::stack<int, s21::forward_list<int>> s1 = {1, 2, 3};
+  std::stack<int> s2({1, 2, 3});
+
+  s1.push(4);
+  s2.push(4);
+  EXPECT_EQ(s1.size(), s2.size());
+  while (!s1.empty()) {
+    EXPECT_EQ(s1.top(), s2.top());
+    s1.pop();
+    s2.pop();
+  }
+  EXPECT_TRUE(s2.empty());
+}
+
+TEST(stack, vectorContainer) {
+  s21::stack<int, s21::vector<int>> s1 = {1, 2, 3};
+  std::stack<int> s2({1, 2, 3});
+
+  for (int i = 0; i < 100; ++i) {
+    s1.push(i);
+    s2.push(i);
+  }
+  s1.insert_many_front(7, 8);
+  s2.push(7);
+  s2.push(8);
+  EXPECT_EQ(s1.size(), s2.size());
+  while (!s1.empty()) {
+    EXPECT_EQ(s1.top(), s2.top());
+    s1.pop();
+    s2.pop();
+  }
+  EXPECT_TRUE(s2.empty());
+}
+
+TEST(stack, moveOnly) {
+  s21::stack<std::unique_ptr<int>> s21_stack;
+  s21_stack.push(std::make_unique<int>(1));
+  s21_stack.emplace(new int(2));
+  s21_stack.insert_many_front(std::make_unique<int>(3));
+  EXPECT_EQ(*s21_stack.top(), 3);
+
+  std::unique_ptr<int> value = s21_stack.pop_value();
+  EXPECT_EQ(*value, 3);
+  EXPECT_TRUE(s21_stack.try_pop(value));
+  EXPECT_EQ(*value, 2);
+  EXPECT_TRUE(s21_stack.try_pop(value));
+  EXPECT_EQ(*value, 1);
+  EXPECT_FALSE(s21_stack.try_pop(value));
+}
+
+template <typename Container>
+void CheckMoveOnlyStack() {
+  s21::stack<std::unique_ptr<int>, Container> s21_stack;
+  for (int i = 0; i < 5; ++i) {
+    s21_stack.emplace(new int(i));
+  }
+  for (int i = 4; i >= 0; --i) {
+    EXPECT_EQ(*s21_stack.pop_value(), i);
+  }
+  EXPECT_TRUE(s21_stack.empty());
+}
+
+TEST(stack, moveOnlyOtherContainers) {
+  CheckMoveOnlyStack<s21::list<std::unique_ptr<int>>>();
+  CheckMoveOnlyStack<s21::vector<std::unique_ptr<int>>>();
+  CheckMoveOnlyStack<s21::forward_list<std::unique_ptr<int>>>();
+  CheckMoveOnlyStack<s21::ring_buffer<std::unique_ptr<int>>>();
+}
+
 }  // namespace
\ No newline at end of file
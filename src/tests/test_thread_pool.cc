@@ -0,0 +1,111 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tests_init.h"
+
+TEST(thread_pool, submit) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3U);
+
+  auto sum = pool.submit([](int a, int b) { return a + b; }, 2, 40);
+  auto text = pool.submit([](std::string s) { return s + "!"; }, "hi");
+  std::atomic<int> counter{0};
+  auto nothing = pool.submit([&counter]() { ++counter; });
+
+  EXPECT_EQ(sum.get(), 42);
+  EXPECT_EQ(text.get(), "hi!");
+  nothing.get();
+  EXPECT_EQ(counter.load(), 1);
+}
+
+TEST(thread_pool, submitException) {
+  s21::thread_pool pool(2);
+  auto future = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(thread_pool, destructorRunsPendingTasks) {
+  std::atomic<int> counter{0};
+  {
+    s21::thread_pool pool(2);
+    for (int i = 0; i < 1000; ++i) {
+      pool.submit([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(thread_pool, tasksSpawnTasks) {
+  std::atomic<int> counter{0};
+  {
+    s21::thread_pool pool(4);
+    for (int i = 0; i < 10; ++i) {
+      pool.submit([&pool, &counter]() {
+        for (int j = 0; j < 100; ++j) {
+          pool.submit([&counter]() { ++counter; });
+        }
+      });
+    }
+  }
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(thread_pool, parallelFor) {
+  s21::thread_pool pool(4);
+  std::vector<long> values(100000);
+  pool.parallel_for(0, static_cast<int>(values.size()),
+                    [&values](int i) { values[i] = 2L * i; });
+  long expected = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    expected += 2L * static_cast<long>(i);
+  }
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0L), expected);
+
+  std::atomic<int> calls{0};
+  pool.parallel_for(5, 5, [&calls](int) { ++calls; });
+  pool.parallel_for(-3, 4, [&calls](int) { ++calls; }, 2);
+  EXPECT_EQ(calls.load(), 7);
+}
+
+TEST(thread_pool, nestedParallelFor) {
+  s21::thread_pool pool(2);
+  std::atomic<long> sum{0};
+  pool.parallel_for(0, 16, [&pool, &sum](int i) {
+    pool.parallel_for(0, 100, [&sum, i](int j) { sum += i * j; }, 10);
+  }, 1);
+  EXPECT_EQ(sum.load(), 120L * 4950L);
+}
+
+TEST(thread_pool, parallelForException) {
+  s21::thread_pool pool(3);
+  std::atomic<int> calls{0};
+  EXPECT_THROW(pool.parallel_for(0, 1000,
+                                 [&calls](int i) {
+                                   ++calls;
+                                   if (i == 500) {
+                                     throw std::out_of_range("bad index");
+                                   }
+                                 }),
+               std::out_of_range);
+  EXPECT_GT(calls.load(), 0);
+}
+
+TEST(thread_pool, defaultPoolIsShared) {
+  s21::thread_pool &pool = s21::default_thread_pool();
+  EXPECT_EQ(&pool, &s21::default_thread_pool());
+  EXPECT_EQ(pool.submit([](int x) { return x * 2; }, 21).get(), 42);
+
+  s21::list<long> longs;
+  s21::list<double> doubles;
+  for (int i = 0; i < 70000; ++i) {
+    longs.push_front(i);
+    doubles.push_front(i);
+  }
+  longs.parallel_sort(4);
+  doubles.parallel_sort(4);
+  EXPECT_EQ(longs.front(), 0);
+  EXPECT_EQ(doubles.back(), 69999.0);
+}
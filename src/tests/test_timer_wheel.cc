@@ -0,0 +1,130 @@
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tests_init.h"
+
+TEST(timer_wheel, fireAtDeadline) {
+  s21::timer_wheel<int> wheel(2, 3);
+  EXPECT_THROW(s21::timer_wheel<int>(0, 8), std::invalid_argument);
+
+  std::vector<std::pair<unsigned long, int>> fired;
+  auto record = [&wheel, &fired](int value) {
+    fired.push_back({wheel.now(), value});
+  };
+  wheel.schedule(5, 1);
+  wheel.schedule(0, 0);
+  wheel.schedule(20, 2);
+  wheel.schedule(63, 3);
+  EXPECT_EQ(wheel.size(), 4U);
+
+  EXPECT_EQ(wheel.advance(4, record), 1U);
+  EXPECT_EQ(wheel.advance(100, record), 3U);
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.now(), 104U);
+  std::vector<std::pair<unsigned long, int>> expected = {
+      {1, 0}, {5, 1}, {20, 2}, {63, 3}};
+  EXPECT_EQ(fired, expected);
+}
+
+TEST(timer_wheel, cancel) {
+  s21::timer_wheel<std::string> wheel;
+  auto first = wheel.schedule(10, "first");
+  auto second = wheel.schedule(10, "second");
+  auto third = wheel.schedule(1000, "third");
+  EXPECT_TRUE(wheel.contains(second));
+  EXPECT_TRUE(wheel.cancel(second));
+  EXPECT_FALSE(wheel.contains(second));
+  EXPECT_FALSE(wheel.cancel(second));
+
+  std::vector<std::string> fired;
+  wheel.advance(10, [&fired](std::string &value) { fired.push_back(value); });
+  EXPECT_EQ(fired, std::vector<std::string>{"first"});
+  EXPECT_FALSE(wheel.cancel(first));
+
+  // узел отмененного таймера переиспользуется, старый дескриптор недействителен
+  auto reused = wheel.schedule(1, "reused");
+  EXPECT_NE(reused, second);
+  EXPECT_FALSE(wheel.contains(second));
+  EXPECT_TRUE(wheel.cancel(third));
+  EXPECT_TRUE(wheel.cancel(reused));
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(timer_wheel, rescheduleFromCallback) {
+  s21::timer_wheel<int> wheel(3, 4);
+  int count = 0;
+  wheel.schedule(7, 0);
+  std::function<void(int &)> periodic = [&](int &value) {
+    EXPECT_EQ(wheel.now(), static_cast<unsigned long>(7 * (value + 1)));
+    ++count;
+    wheel.schedule(7, value + 1);
+  };
+  wheel.advance(700, periodic);
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(wheel.size(), 1U);
+}
+
+TEST(timer_wheel, pendingPayloadsDestroyed) {
+  s21::timer_wheel<std::unique_ptr<int>> wheel;
+  for (int i = 0; i < 1000; ++i) {
+    wheel.schedule(i * 1000, std::make_unique<int>(i));
+  }
+  int fired = 0;
+  wheel.advance(5000, [&fired](std::unique_ptr<int> &value) {
+    EXPECT_EQ(*value, fired++);
+  });
+  EXPECT_EQ(fired, 6);
+}
+
+namespace {
+
+// каждый неотмененный таймер должен сработать ровно в свой срок
+void CheckAgainstReference(size_t levels, size_t slot_bits,
+                           unsigned long max_delay) {
+  s21::timer_wheel<int> wheel(levels, slot_bits);
+  std::mt19937 random(7);
+  std::map<int, unsigned long> deadlines;
+  std::vector<s21::timer_wheel<int>::handle_type> handles;
+  int fired = 0;
+  auto check = [&](int id) {
+    auto it = deadlines.find(id);
+    ASSERT_NE(it, deadlines.end());
+    EXPECT_EQ(it->second, wheel.now()) << id;
+    deadlines.erase(it);
+    ++fired;
+  };
+
+  int next_id = 0;
+  for (int round = 0; round < 2000; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      unsigned long delay = 1 + random() % max_delay;
+      deadlines[next_id] = wheel.now() + delay;
+      handles.push_back(wheel.schedule(delay, next_id));
+      ++next_id;
+    }
+    if (random() % 3 == 0) {
+      int victim = static_cast<int>(random() % handles.size());
+      if (wheel.cancel(handles[victim])) {
+        deadlines.erase(victim);
+      }
+    }
+    wheel.advance(1 + random() % 64, check);
+  }
+  wheel.advance(max_delay + 1, check);
+  EXPECT_TRUE(deadlines.empty());
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_GT(fired, 0);
+}
+
+}  // namespace
+
+TEST(timer_wheel, matchesReference) {
+  CheckAgainstReference(3, 4, 3000);
+  // сроки за горизонтом колеса (2^12 тиков)
+  CheckAgainstReference(3, 4, 20000);
+  CheckAgainstReference(1, 5, 200);
+}
@@ -1,3 +1,5 @@
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "tests_init.h"
@@ -538,3 +540,25 @@ TEST(operator, operator_bracket_const) {
   EXPECT_EQ(const_vec[3], 4);
   EXPECT_EQ(const_vec[4], 5);
 }
+
+TEST(method, emplace_back) {
+  s21::vector<std::unique_ptr<int>> vec;
+  for (int i = 0; i < 10; ++i) {
+    vec.push_back(std::make_unique<int>(i));
+  }
+  vec.emplace_back(new int(10));
+  EXPECT_EQ(vec.size(), 11U);
+  for (int i = 0; i <= 10; ++i) {
+    EXPECT_EQ(*vec[i], i);
+  }
+  std::unique_ptr<int> last = std::move(vec.back());
+  EXPECT_EQ(*last, 10);
+  EXPECT_EQ(vec.back(), nullptr);
+
+  s21::vector<std::string> strings;
+  EXPECT_EQ(strings.emplace_back(3, 'a'), "aaa");
+  strings.reserve(1);
+  // аргумент ссылается на элемент, который переедет при росте
+  strings.push_back(strings.front());
+  EXPECT_EQ(strings[1], "aaa");
+}
@@ -0,0 +1,69 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "tests_init.h"
+
+TEST(work_stealing_deque, ownerLifoThiefFifo) {
+  s21::work_stealing_deque<int> deque(2);
+  EXPECT_TRUE(deque.empty());
+  for (int i = 0; i < 100; ++i) {
+    deque.push(i);
+  }
+  EXPECT_EQ(deque.size(), 100U);
+
+  int value = -1;
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 99);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+
+  int expected = 98;
+  while (deque.pop(value)) {
+    EXPECT_EQ(value, expected--);
+  }
+  EXPECT_EQ(expected, 1);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.steal(value));
+}
+
+TEST(work_stealing_deque, concurrentSteal) {
+  const int kThieves = 3;
+  const int kItems = 200000;
+  s21::work_stealing_deque<int> deque(8);
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<bool> done{false};
+
+  std::thread thieves[kThieves];
+  for (int t = 0; t < kThieves; ++t) {
+    thieves[t] = std::thread([&deque, &seen, &done]() {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value)) {
+          ++seen[value];
+        }
+      }
+    });
+  }
+  // владелец попеременно кладет и забирает, заставляя дек расти
+  int value;
+  for (int i = 0; i < kItems; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) {
+      ++seen[value];
+    }
+  }
+  while (deque.pop(value)) {
+    ++seen[value];
+  }
+  done = true;
+  for (std::thread &thief : thieves) {
+    thief.join();
+  }
+
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(seen[i].load(), 1) << i;
+  }
+}